@@ -0,0 +1,198 @@
+#pragma once
+#ifndef ANALOGSENSORSFILE_CPP
+#define ANALOGSENSORSFILE_CPP
+
+#include "AnalogSensors.h"
+
+#ifdef TARGET_GAME_ANALOG_SENSORS
+
+#include <avr/interrupt.h>
+
+/// @todo Tune on site. Values are in ADC counts scaled by 16 (8.4 fixed point).
+constexpr uint8_t EXTRA_FRACTION       = 4;       // Stored estimates carry 4 more bits (8.8).
+constexpr bool    LIGHT_RAISES_READING = true;   // LDR on high (5V) side of divider.
+constexpr int16_t MIN_MARGIN           = 24 << 4; // ~10% of full scale above baseline.
+constexpr uint8_t NOISE_FACTOR         = 4;       // Margin in multiples of mean deviation.
+constexpr uint8_t BASELINE_SHIFT       = 7;       // Baseline follows ambient over ~128 samples (~0.3 s).
+constexpr uint8_t DEVIATION_SHIFT      = 5;
+constexpr uint8_t MAX_HIT_SAMPLES      = 215;     // ~0.5 s; Longer is an ambient step, not a hit.
+constexpr uint8_t AMBIENT_SHARE        = 2;       // Over 1/2 of sensors lit at once is ambient.
+
+const SensorMuxPorts SELECT_PORTS[] = {SensorMuxPorts::Select0, SensorMuxPorts::Select1,
+      SensorMuxPorts::Select2, SensorMuxPorts::Select3};
+
+// Divide by 2^shift, rounding half up. Plain >> floors negative values.
+static inline int16_t roundedShift(int16_t value, uint8_t shift){
+  return (value + (1 << (shift - 1))) >> shift;
+}
+
+// Instance serviced by the ADC interrupt.
+static analog_sensors::AnalogSensorInterface* adc_owner_ = nullptr;
+
+ISR(ADC_vect){
+  if (adc_owner_){
+    adc_owner_->handleConversion();
+  }
+}
+
+namespace analog_sensors {
+
+  // Constructor
+  AnalogSensorInterface::AnalogSensorInterface():
+    seeded_(0),
+    active_(0),
+    latched_(0),
+    pending_(0),
+    sensor_(0),
+    settled_(false)
+  {
+    baseline_.fill(0);
+    deviation_.fill(0);
+    hit_samples_.fill(0);
+  }
+
+  void AnalogSensorInterface::begin(){
+    // Cache select pin registers; digitalWrite is too slow for the ISR.
+    for (uint8_t i = 0; i < SELECT_PINS; i++){
+      uint8_t pin = static_cast<uint8_t>(SELECT_PORTS[i]);
+      pinMode(pin, OUTPUT);
+      select_reg_[i] = portOutputRegister(digitalPinToPort(pin));
+      select_bit_[i] = digitalPinToBitMask(pin);
+    }
+
+    sensor_  = 0;
+    settled_ = false;
+    selectSensor(sensor_);
+    adc_owner_ = this;
+
+    uint8_t channel = static_cast<uint8_t>(SensorMuxPorts::Analog_Input) - A0;
+
+    // AVcc reference, left adjusted 8-bit result in ADCH.
+    ADMUX  = _BV(REFS0) | _BV(ADLAR) | (channel & 0x07);
+    // Digital input buffer is not needed on the analog input.
+    DIDR0 |= _BV(channel);
+    // Free running trigger.
+    ADCSRB = 0;
+    // Enable, auto trigger, interrupt, /128 prescaler (125 kHz) and start.
+    ADCSRA = _BV(ADEN) | _BV(ADATE) | _BV(ADIE) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0) | _BV(ADSC);
+  }
+
+  TargetMask AnalogSensorInterface::frame(){
+    uint8_t sreg = SREG;
+    cli();
+
+    TargetMask hits = latched_;
+    latched_ = 0;
+
+    SREG = sreg;
+    return hits;
+  }
+
+  void AnalogSensorInterface::handleConversion(){
+    uint8_t reading = ADCH;
+
+    // The conversion after a channel switch may have sampled the previous
+    // sensor; Discard it.
+    if (!settled_){
+      settled_ = true;
+      return;
+    }
+
+    classify(sensor_, reading);
+
+    if (sensor_ + 1 == TOTAL_TARGETS){
+      endSweep();
+      sensor_ = 0;
+    }else{
+      sensor_++;
+    }
+    selectSensor(sensor_);
+    settled_ = false;
+  }
+
+// Private Functions
+  void AnalogSensorInterface::selectSensor(uint8_t sensor){
+    for (uint8_t i = 0; i < SELECT_PINS; i++){
+      if (sensor & (1 << i)){
+        *select_reg_[i] |= select_bit_[i];
+      }else{
+        *select_reg_[i] &= ~select_bit_[i];
+      }
+    }
+  }
+
+  void AnalogSensorInterface::endSweep(){
+    uint8_t seeded = __builtin_popcount(seeded_);
+    uint8_t lit    = __builtin_popcount(active_ & seeded_);
+
+    // Most sensors lit in the same sweep is a room light or the sun, not
+    // players; Re-seed those sensors at the new level and report nothing.
+    if (seeded && lit * AMBIENT_SHARE > seeded){
+      for (uint8_t i = 0; i < TOTAL_TARGETS; i++){
+        if (active_ & (static_cast<TargetMask>(1) << i)){
+          hit_samples_[i] = 0;
+        }
+      }
+      seeded_ &= ~active_;
+      active_  = 0;
+      pending_ = 0;
+      return;
+    }
+
+    latched_ |= pending_;
+    pending_  = 0;
+  }
+
+  void AnalogSensorInterface::classify(uint8_t sensor, uint8_t reading){
+    TargetMask bit = static_cast<TargetMask>(1) << sensor;
+    int16_t level = static_cast<int16_t>(reading) << 4;
+
+    // First reading seeds the baseline.
+    if (!(seeded_ & bit)){
+      baseline_[sensor]  = static_cast<uint16_t>(level) << EXTRA_FRACTION;
+      deviation_[sensor] = 0;
+      seeded_ |= bit;
+      return;
+    }
+
+    // Back to 8.4; Unsigned, as 8.8 values use the full 16 bits.
+    constexpr uint16_t HALF = 1 << (EXTRA_FRACTION - 1);
+    int16_t baseline  = static_cast<int16_t>((baseline_[sensor]  + HALF) >> EXTRA_FRACTION);
+    int16_t deviation = static_cast<int16_t>((deviation_[sensor] + HALF) >> EXTRA_FRACTION);
+    int16_t delta     = level - baseline;
+    int16_t rise  = LIGHT_RAISES_READING ? delta : -delta;
+
+    // Threshold sits above ambient noise; Release at half for hysteresis.
+    int16_t margin = max(MIN_MARGIN, static_cast<int16_t>(deviation * NOISE_FACTOR));
+    if (active_ & bit){
+      margin /= 2;
+    }
+
+    if (rise > margin){
+      // Light held past any plausible hit means ambient has stepped up;
+      // Re-seed from the new level instead of reporting "hit" forever.
+      if (++hit_samples_[sensor] > MAX_HIT_SAMPLES){
+        seeded_ &= ~bit;
+        active_ &= ~bit;
+        hit_samples_[sensor] = 0;
+        return;
+      }
+      active_  |= bit;
+      pending_ |= bit;
+      return;
+    }
+    active_ &= ~bit;
+    hit_samples_[sensor] = 0;
+
+    // Track ambient only while not "hit". Steps are rounded and kept with
+    // extra fraction bits; A floored 8.4 step stalls up to 8 counts short
+    // of ambient and always drifts low.
+    baseline_[sensor]  += roundedShift(delta, BASELINE_SHIFT - EXTRA_FRACTION);
+    deviation_[sensor] += roundedShift(abs(delta) - deviation, DEVIATION_SHIFT - EXTRA_FRACTION);
+  }
+
+} // namespace analog_sensors
+
+#endif
+
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+#ifndef ANALOGSENSORSFILE_H
+#define ANALOGSENSORSFILE_H
+
+// Arduino Libs
+#include <Arduino.h>
+#include <Array.h>
+
+// Custom Libs
+#include "Types.h"
+#include "stdint.h"
+
+using SensorMuxPorts = types::SensorMuxPorts;
+using TargetMask     = types::TargetMask;
+
+using namespace types;
+
+namespace analog_sensors { class AnalogSensorInterface{
+
+  public:
+  // Constructor
+  AnalogSensorInterface();
+
+  // Destructor
+  ~AnalogSensorInterface() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Configure multiplexer pins and start free running,
+  ///             interrupt driven ADC conversion.
+  /// @note       8-bit results at 125 kHz ADC clock: ~9.6k conversions/s.
+  ///             One conversion is discarded after each channel switch, so
+  ///             every sensor is sampled ~430 times/s.
+  ///             Sensors must not be lit while baselines settle. A sensor
+  ///             held above threshold for ~0.5 s is re-seeded at its new
+  ///             level, as ambient has changed rather than a target hit.
+  ///             Hits are reported one sweep (~2.3 ms) late so that a
+  ///             change lighting most sensors at once can be discarded.
+  //////////////////////////////////////////////////////////////////////////////
+  void begin();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Latch the sensor states seen since the previous frame.
+  /// @return     Mask of every target "hit"; Bit n is Targets n. Matches
+  ///             the 74HC165 chain scan.
+  /// @note       A sensor that crossed its threshold between frames is
+  ///             reported once even if it has since released.
+  //////////////////////////////////////////////////////////////////////////////
+  TargetMask frame();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Process the conversion that just completed.
+  /// @note       Called from the ADC interrupt only.
+  //////////////////////////////////////////////////////////////////////////////
+  void handleConversion();
+
+  //
+  // Private functions
+  //
+  private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Route a sensor to the ADC input.
+  /// @param[in]  sensor - Sensor (target) index.
+  //////////////////////////////////////////////////////////////////////////////
+  void selectSensor(uint8_t sensor);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Update baseline and noise estimate and classify a reading.
+  /// @param[in]  sensor - Sensor (target) index.
+  /// @param[in]  reading - 8-bit ADC result.
+  //////////////////////////////////////////////////////////////////////////////
+  void classify(uint8_t sensor, uint8_t reading);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Release the hits seen during a full sweep of all sensors,
+  ///             unless most sensors crossed together (ambient change).
+  //////////////////////////////////////////////////////////////////////////////
+  void endSweep();
+
+  //
+  // Member Variables
+  //
+  static constexpr uint8_t SELECT_PINS = 4;
+
+  Array<uint16_t, types::TOTAL_TARGETS> baseline_;    // Ambient level; 8.8 fixed point.
+  Array<uint16_t, types::TOTAL_TARGETS> deviation_;   // Mean absolute deviation; 8.8 fixed point.
+  Array<uint8_t, types::TOTAL_TARGETS> hit_samples_;  // Consecutive samples above threshold.
+  Array<volatile uint8_t*, SELECT_PINS> select_reg_;  // Cached for use in ISR.
+  Array<uint8_t, SELECT_PINS> select_bit_;
+  TargetMask seeded_;                                 // Sensors with an initial baseline.
+  TargetMask active_;                                 // Sensors currently above threshold.
+  volatile TargetMask latched_;                       // Sensors hit since last frame.
+  TargetMask pending_;                                // Sensors hit this sweep; Not yet reported.
+  uint8_t sensor_;                                    // Sensor routed to the ADC.
+  bool settled_;                                      // Whether mux has settled since switch.
+
+};} // namespace analog_sensors
+#endif
@@ -0,0 +1,145 @@
+#pragma once
+#ifndef BENCHMARKFILE_CPP
+#define BENCHMARKFILE_CPP
+
+#include "Benchmark.h"
+
+#ifdef TARGET_GAME_BENCHMARK
+
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "MemoryUsage.h"
+
+constexpr uint16_t PORT_ITERATIONS    = 64;
+constexpr uint16_t SCAN_ITERATIONS    = 64;   // POST_READ_WAIT is 0 in benchmark builds.
+constexpr uint16_t DISPLAY_ITERATIONS = 16;   // LCD transport is stubbed; See: Game.h.
+
+// Upper 16 bits of the Timer1 cycle counter.
+static volatile uint16_t timer1_overflows_ = 0;
+
+ISR(TIMER1_OVF_vect){
+  timer1_overflows_++;
+}
+
+namespace benchmark {
+
+  // Constructor
+  BenchmarkInterface::BenchmarkInterface():
+    game_ifc_(),
+    overhead_(0)
+  {}
+
+  void BenchmarkInterface::runBenchmarks(){
+    Serial.println(F("--------- Begin Benchmarks ---------"));
+
+    // LCD must be configured before display updates can be timed.
+    game_ifc_.setupLcd();
+    // Draw static labels so only the per-call update is measured.
+    game_ifc_.updateDisplay(0, true);
+
+    setupCycleCounter();
+
+    // Measure the cost of the measurement itself.
+    uint32_t start = readCycles();
+    overhead_ = readCycles() - start;
+
+    // Port Access: full chain scan with no "hit" (worst case).
+    start = readCycles();
+    for (uint16_t i = 0; i < SCAN_ITERATIONS; i++){
+      game_ifc_.port_ifc_.sampleInputs();
+    }
+    report(F("sampleInputs"), readCycles() - start, SCAN_ITERATIONS);
+
+    // Port Access: full LED chain shift.
+    start = readCycles();
+    for (uint16_t i = 0; i < PORT_ITERATIONS; i++){
+      game_ifc_.port_ifc_.updateLeds();
+    }
+    report(F("updateLeds"), readCycles() - start, PORT_ITERATIONS);
+
+    // Game: cooldown check across all targets, every hit inside the cooldown.
+    game_ifc_.last_hit_time_.fill(0);
+    start = readCycles();
+    for (uint16_t i = 0; i < PORT_ITERATIONS; i++){
+      game_ifc_.validHit(static_cast<Targets>(i % TOTAL_TARGETS), i);
+    }
+    report(F("validHitReject"), readCycles() - start, PORT_ITERATIONS);
+
+    // Game: cooldown check across all targets, every hit accepted. Hits are
+    // a full cooldown apart so each one stamps last_hit_time_.
+    unsigned long now = 0;
+    start = readCycles();
+    for (uint16_t i = 0; i < PORT_ITERATIONS; i++){
+      now += game_ifc_.settings_.hit_cooldown;
+      game_ifc_.validHit(static_cast<Targets>(i % TOTAL_TARGETS), now);
+    }
+    report(F("validHitAccept"), readCycles() - start, PORT_ITERATIONS);
+
+    // Game: time and score refresh.
+    start = readCycles();
+    for (uint16_t i = 0; i < DISPLAY_ITERATIONS; i++){
+      game_ifc_.updateDisplay(0, true);
+    }
+    report(F("updateDisplay"), readCycles() - start, DISPLAY_ITERATIONS);
+
+    // Stack high-water mark includes every path exercised above.
+    memory_usage::printReport();
+
+    Serial.println(F("BENCH DONE"));
+    Serial.flush();
+
+    // Halt. simavr terminates when the core sleeps with interrupts disabled.
+    cli();
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    sleep_cpu();
+  }
+
+// Private Functions
+  void BenchmarkInterface::setupCycleCounter(){
+    uint8_t sreg = SREG;
+    cli();
+
+    // Normal mode, no prescaler: one tick per CPU cycle.
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10);
+    TCNT1  = 0;
+    timer1_overflows_ = 0;
+    TIFR1  = _BV(TOV1);
+    TIMSK1 = _BV(TOIE1);
+
+    SREG = sreg;
+  }
+
+  uint32_t BenchmarkInterface::readCycles(){
+    uint8_t sreg = SREG;
+    cli();
+
+    uint16_t low  = TCNT1;
+    uint16_t high = timer1_overflows_;
+
+    // Account for an overflow that has not been serviced yet.
+    if ((TIFR1 & _BV(TOV1)) && low < 0x8000){
+      high++;
+    }
+
+    SREG = sreg;
+    return (static_cast<uint32_t>(high) << 16) | low;
+  }
+
+  void BenchmarkInterface::report(const __FlashStringHelper* name, uint32_t total, uint16_t iterations){
+    // Remove measurement cost before averaging.
+    total = (total > overhead_) ? total - overhead_ : 0;
+
+    Serial.print(F("BENCH "));
+    Serial.print(name);
+    Serial.print(F(" "));
+    Serial.println(total / iterations);
+  }
+
+} // namespace benchmark
+
+#endif
+
+#endif
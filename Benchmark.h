@@ -0,0 +1,67 @@
+#pragma once
+#ifndef BENCHMARKFILE_H
+#define BENCHMARKFILE_H
+
+// Arduino Libs
+#include <Arduino.h>
+
+// Custom Libs
+#include "Types.h"
+#include "stdint.h"
+#include "Game.h"
+
+using GameInterface = game::GameInterface;
+
+using namespace types;
+
+namespace benchmark { class BenchmarkInterface{
+
+  public:
+  // Constructor
+  BenchmarkInterface();
+
+  // Destructor
+  ~BenchmarkInterface() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Time each game/port hot path and report cycles per call.
+  /// @note       Results are printed over serial as one line per benchmark:
+  ///             "BENCH <name> <cycles>". Comparison against the stored
+  ///             baseline is done on the host (See: tools/bench.sh).
+  ///             Prints "BENCH DONE" and halts the CPU when complete so
+  ///             a simulator (simavr) exits on its own.
+  //////////////////////////////////////////////////////////////////////////////
+  void runBenchmarks();
+
+  //
+  // Private functions
+  //
+  private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Configure Timer1 as a free running, unscaled cycle counter.
+  /// @note       Timer1 must not be used elsewhere while benchmarking.
+  //////////////////////////////////////////////////////////////////////////////
+  void setupCycleCounter();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Read the extended (32-bit) cycle counter.
+  /// @return     CPU cycles elapsed since counter was configured.
+  //////////////////////////////////////////////////////////////////////////////
+  uint32_t readCycles();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Print a single benchmark result.
+  /// @param[in]  name - Benchmark identifier. Must be stored in flash.
+  /// @param[in]  total - Total cycles spent over all iterations.
+  /// @param[in]  iterations - Number of calls made.
+  //////////////////////////////////////////////////////////////////////////////
+  void report(const __FlashStringHelper* name, uint32_t total, uint16_t iterations);
+
+  //
+  // Member Variables
+  //
+  GameInterface game_ifc_;
+  uint32_t overhead_;     // Cycles spent by an empty measurement.
+
+};} // namespace benchmark
+#endif
@@ -3,72 +3,115 @@
 #define GAMEFILE_CPP
 
 #include "Game.h"
+#include "MemoryUsage.h"
 #include "math.h"
 #include <EEPROM.h>
-
-constexpr uint16_t GAME_DURATION = 60 * SECOND;
-constexpr uint16_t INIT_WAIT = 500;         // in ms.
-constexpr uint8_t  WIN_SCORE = 25;
+#include <avr/pgmspace.h>
+
+// Game timing and scoring are set by the active profile; See Profile.cpp.
+
+// LCD Layout (in characters).
+constexpr uint8_t LCD_COLUMNS = 16;                            // 128 pixels / 8 pixel font.
+constexpr uint8_t START_POS   = 0;                             // Left-most character of line.
+constexpr uint8_t OFFSET_POS  = 3;                             // 3*Character_Width pixels from left-most pixels of line.
+constexpr uint8_t LABEL_POS   = 0;                             // Top line of lcd.
+constexpr uint8_t VALUE_POS   = 2;                             // Allows for "Double Spacing" effect.
+constexpr uint8_t SCORE_WIDTH = 2;                             // Of the format "xx"
+constexpr uint8_t SUFFIX_POS  = OFFSET_POS + SCORE_WIDTH + 1;  // Add space between val and suffix.
+
+// Static LCD text drawn once per game. Kept entirely in flash.
+struct LcdLabel {
+  uint8_t x;
+  uint8_t y;
+  const char* text;   // PROGMEM string.
+};
+
+const char TIME_LABEL[]   PROGMEM = "Time Left:";
+const char TIME_SUFFIX[]  PROGMEM = "secs";
+const char SEPARATOR[]    PROGMEM = "--------";
+const char SCORE_LABEL[]  PROGMEM = "SCORE:";
+const char SCORE_SUFFIX[] PROGMEM = "pnts";
+
+const LcdLabel GAME_LABELS[] PROGMEM = {
+  {START_POS,      LABEL_POS,     TIME_LABEL},    // Line 0.
+  {SUFFIX_POS,     VALUE_POS,     TIME_SUFFIX},   // Line 2.
+  {OFFSET_POS - 1, VALUE_POS + 1, SEPARATOR},     // Line 3.
+  {START_POS,      VALUE_POS * 2, SCORE_LABEL},   // Line 4.
+  {SUFFIX_POS,     VALUE_POS * 2, SCORE_SUFFIX},  // Line 4.
+};
 
 namespace game {
 
   GameInterface::GameInterface():
-    player_score_(0),
     start_game_(false),
-    start_time_(0),
-    target_value_(5),
+    arm_time_(0),
     lcd_(U8X8_PIN_NONE),              // See: (https://github.com/olikraus/u8g2/wiki/u8x8setupcpp#wiring)
-    start_pos_(0),                
-    offset_pos_(3),                   // 3*Character_Width pixels from left-most pixels of line.
-    label_pos_(0),                    // Top line of lcd.
-    value_pos_(2),                    // Allows for "Double Spacing" effect.
     first_score_update_(false),
-    multiply_points_(false),
-    point_multiplier_(2),
-    bonus_time_start_(40*SECOND),     // Bonus time starts 40 seconds after game begins.
-    bonus_time_end(50*SECOND),        // Bonus time ends 10 seconds after it begins.
-    port_ifc_()
+    port_ifc_(),
+    profile_ifc_()
   {
+    resetLanes();
+
     // Ensure all targets increment player score on first hit.
     last_hit_time_.fill(0);
+
+    // Usable settings before EEPROM profile is loaded in `setupGame`.
+    profile_ifc_.loadDefault(settings_);
   }
 
   void GameInterface::setupGame(){
 
-    
+    // Apply selected game profile. Initialization waits depend on it.
+    bool profile_loaded = profile_ifc_.loadActive(settings_);
+    journal_ifc_.begin();
+
     // Begin LCD configuration.
     setupLcd();
 
+    Serial.print(F("Game profile: "));
+    if (profile_loaded){
+      Serial.println(profile_ifc_.activeSlot());
+    }else{
+      Serial.println(F("default"));
+    }
+
     // Verify Expected System State.
     bool ready = (
-      (player_score_ == 0)        &&
       (start_game_   == false)    &&
-      (multiply_points_ == false) &&
-      (target_value_ == 5)        &&
-      (point_multiplier_ == 2)    &&
       (port_ifc_.ioSet())      
     );
+    for (uint8_t i = 0; i < MAX_LANES; i++){
+      const LaneState& lane = lanes_[i];
+      ready = ready                           &&
+        (lane.score == 0)                     &&
+        (lane.started == false)               &&
+        (lane.multiply_points == false)       &&
+        (lane.reactions.count() == 0);
+    }
 
-    lcd_.setCursor(offset_pos_, value_pos_);  
+    lcd_.setCursor(OFFSET_POS, VALUE_POS);  
     if (ready){
        lcd_.print(F("50%"));
     }else{
        lcd_.print(F("FAIL"));
     }
-    delay(INIT_WAIT);
+    delay(settings_.init_wait);
 
     // Visual verification required.
     port_ifc_.flashLEDs();
-    lcd_.setCursor(offset_pos_, value_pos_);
+    lcd_.setCursor(OFFSET_POS, VALUE_POS);
     lcd_.print(F("75%"));
-    delay(INIT_WAIT);
+    delay(settings_.init_wait);
 
 
     // External action required.
     port_ifc_.verifyTargets();
-    lcd_.setCursor(offset_pos_, value_pos_);
+    lcd_.setCursor(OFFSET_POS, VALUE_POS);
     lcd_.print(F("PASS"));
-    delay(INIT_WAIT);
+    delay(settings_.init_wait);
+
+    // Report memory headroom once all components have been exercised.
+    memory_usage::printReport();
 
     Serial.println(F("--------- All Verifications Completed ---------"));
     Serial.println(F(""));
@@ -78,12 +121,25 @@ namespace game {
 
   void GameInterface::runGame(){
 
-    Targets target;
     // Setup Stuff.
-    updateDisplay(true);
+    for (uint8_t lane = 0; lane < settings_.lanes; lane++){
+      updateDisplay(lane, true);
+    }
+
+    // Booth is ready; Time until start approximates player queueing.
+    unsigned long ready_time = millis();
 
     // Wait for start button to be pressed.
     do{
+      // Allow journal download and switching game profile between games.
+      journal_ifc_.handleCommand();
+      if (profile_ifc_.handleCommand(settings_)){
+        first_score_update_ = false;
+        for (uint8_t lane = 0; lane < settings_.lanes; lane++){
+          updateDisplay(lane, true);
+        }
+      }
+
       start_game_ = port_ifc_.sampleStartButton();
 
       /// @todo consider different approach. Starts game once target "hit".
@@ -91,26 +147,54 @@ namespace game {
     } while (!start_game_);
 
     // Once start signal received, start game and store total program run time.
-    start_time_ = millis();
+    arm_time_ = millis();
+    journal_ifc_.startGame(settings_.lanes, profile_ifc_.activeSlot(), arm_time_ - ready_time);
+
+    // All targets become active as the game starts.
+    last_hit_time_.fill(micros() - settings_.hit_cooldown);
+
+    // A single player starts with the button. In multi-lane mode, each
+    // lane starts with its player's first "hit".
+    if (settings_.lanes == 1){
+      startLane(0, arm_time_);
+    }
+    updateLaneLeds();
 
     // Compares program run time at evaluation vs game start.
     // Simple timing may lead to discrepencies of +50 ms between games. Not significant in this case.
+    TargetMask held = 0;    // Targets "hit" in previous frame.
     do{
 
-      // Update score and display if valid target "hit" detected.
-      if(port_ifc_.targetHit(target)){
-        updateScore(target);
+      // Serve every lane from the same chain scan.
+      TargetMask hits  = port_ifc_.targetFrame();
+      TargetMask fresh = hits & ~held;
+      held = hits;
+      while (hits){
+        Targets target = static_cast<Targets>(__builtin_ctz(hits));
+        hits &= hits - 1;
+
+        // Ignore targets left over after an uneven lane split.
+        uint8_t lane = laneOf(target);
+        if (lane >= settings_.lanes){
+          continue;
+        }
+
+        if (!lanes_[lane].started){
+          startLane(lane, millis());
+        }
+
+        // Update score and display if valid target "hit" detected.
+        // Journal cooldown rejects once per "hit", not once per frame.
+        if (!lanes_[lane].finished && !updateScore(lane, target) &&
+            (fresh & (static_cast<TargetMask>(1) << static_cast<uint8_t>(target)))){
+          journal_ifc_.recordReject(target);
+        }
       }
 
-      // Loop until the time limit has been reached.
-    } while(start_time_ + GAME_DURATION > millis());
+      // Loop until the time limit of every lane has been reached.
+    } while(updateLanes(millis()));
 
-    // Check if player has scored necessary points to win game.
-    if(player_score_ >= WIN_SCORE){
-      endGame(GameResult::Win);
-    }
-    // Player has not scored necessary points to win game within the time limit.
-    endGame(GameResult::Lose);
+    endGame();
     
   }
 
@@ -124,10 +208,10 @@ namespace game {
     // Reference: https://github.com/olikraus/u8g2/wiki/fntgrpopengameart#victoriabold8
     lcd_.setFont(u8x8_font_victoriabold8_r);
 
-    lcd_.setCursor(start_pos_, label_pos_);
+    lcd_.setCursor(START_POS, LABEL_POS);
     lcd_.print(F("INITIALIZE:"));
 
-    lcd_.setCursor(offset_pos_, value_pos_);
+    lcd_.setCursor(OFFSET_POS, VALUE_POS);
     lcd_.print(F("0%"));
     
     Serial.println(F("Configuration completed."));
@@ -135,17 +219,80 @@ namespace game {
     Serial.println(F(""));
 
     // Create time for visual verification.
-    delay(INIT_WAIT);
+    delay(settings_.init_wait);
+  }
+
+  void GameInterface::resetLanes(){
+    for (uint8_t i = 0; i < MAX_LANES; i++){
+      LaneState& lane = lanes_[i];
+      lane.start_time      = 0;
+      lane.started         = false;
+      lane.finished        = false;
+      lane.multiply_points = false;
+      lane.score           = 0;
+      lane.reactions.reset();
+    }
+  }
+
+  uint8_t GameInterface::laneOf(Targets target){
+    return static_cast<uint8_t>(target) / settings_.lane_size;
+  }
+
+  void GameInterface::startLane(uint8_t lane, unsigned long now){
+    lanes_[lane].started    = true;
+    lanes_[lane].start_time = now;
+  }
+
+  bool GameInterface::updateLanes(unsigned long now){
+    bool playing = false;
+    bool changed = false;
+
+    for (uint8_t i = 0; i < settings_.lanes; i++){
+      LaneState& lane = lanes_[i];
+      if (lane.finished){
+        continue;
+      }
+
+      // Lanes that never started are timed from the start button.
+      unsigned long since = now - (lane.started ? lane.start_time : arm_time_);
+      if (since >= settings_.game_duration){
+        lane.finished = true;
+        changed = true;
+        continue;
+      }
+      playing = true;
+    }
+
+    // Turn off LEDs of finished lanes.
+    if (changed){
+      updateLaneLeds();
+    }
+
+    return playing;
+  }
+
+  void GameInterface::updateLaneLeds(){
+    TargetMask lane_mask = (static_cast<TargetMask>(1) << settings_.lane_size) - 1;
+    TargetMask leds = 0;
+
+    // LEDs only mark lanes; A single player plays with them off as before.
+    if (settings_.lanes > 1){
+      for (uint8_t i = 0; i < settings_.lanes; i++){
+        if (!lanes_[i].finished){
+          leds |= lane_mask << (i * settings_.lane_size);
+        }
+      }
+    }
+
+    port_ifc_.setLedFrame(leds);
   }
 
   bool GameInterface::validHit(Targets t_hit, unsigned long now){
-    // Define cooldown period for targets.
-    unsigned long min_cooldown = 3 * SECOND;
     uint8_t t_index = static_cast<uint8_t>(t_hit);
     
 
     // Check recorded time of last hit and compare to now.
-    if ((last_hit_time_[t_index] - now ) >= min_cooldown){
+    if ((now - last_hit_time_[t_index]) >= settings_.hit_cooldown){
       // Update last hit time for target.
       last_hit_time_[t_index] = now;
       return true;
@@ -154,106 +301,191 @@ namespace game {
     return false;
   }
 
-  void GameInterface::updateScore(Targets t_hit){
+  bool GameInterface::updateScore(uint8_t lane, Targets t_hit){
+    LaneState& state = lanes_[lane];
     
     // Determine if player can earn double points.
-    unsigned long now = millis();    
-    if (now - start_game_ >= bonus_time_start_ && multiply_points_ == false){
-      multiply_points_ = true;
-    }else if (now - start_game_ >= bonus_time_end && multiply_points_ == true) {
-      multiply_points_ = false;
-    }
+    unsigned long elapsed = millis() - state.start_time;
+    state.multiply_points = (elapsed >= settings_.bonus_start && elapsed < settings_.bonus_end);
+
+    // Stamp "hit" with frame latch time rather than time handled.
+    unsigned long hit_time = port_ifc_.frameTime();
+    uint8_t t_index = static_cast<uint8_t>(t_hit);
+    unsigned long active_time = last_hit_time_[t_index] + settings_.hit_cooldown;
 
     // Update stored player score by target's value if minimum
     // cooldown period has passed since target last hit.
-    if(validHit(t_hit, now)){
-      if(multiply_points_){
-        player_score_ += (target_value_ * point_multiplier_);
-      }else{
-        player_score_+= target_value_;
+    if(validHit(t_hit, hit_time)){
+      state.reactions.add(hit_time - active_time);
+
+      uint8_t points = settings_.target_value;
+      if(state.multiply_points){
+        points *= settings_.point_multiplier;
       }
+      // Saturate; Score is 8-bit and a long game can outrun it.
+      state.score = (points > UINT8_MAX - state.score) ? UINT8_MAX : state.score + points;
+      journal_ifc_.recordHit(t_hit, points);
+
       // Refresh display.
-      updateDisplay(true);
+      updateDisplay(lane, true);
+      return true;
     }
+
+    return false;
   }
 
-  void GameInterface::updateDisplay(bool update_score){
-
-    // Define score/time-specific x,y positioning vars.
-    uint8_t time_label_x_y = start_pos_;                      // Left-Most Pixel.
-    uint8_t time_value_x   = offset_pos_;                     // 3 character_width offset.
-    uint8_t time_value_y   = value_pos_;                      // Line 2.
-    uint8_t separator_x    = offset_pos_ - 1;
-    uint8_t separator_y    = time_value_y + 1;                // Line 3.
-    uint8_t score_label_x  = start_pos_;                      // Left-Most Pixel.
-    uint8_t score_label_y  = value_pos_*2;                    // Line 4.
-    uint8_t score_value_x  = offset_pos_;                     // 3 character_width offset.
-    uint8_t score_value_y  = value_pos_*2;                    // Line 6.
-    uint8_t fixed_width    = 2;                               // Of the format "xx"
-    uint8_t suffix_pos     = offset_pos_ + (fixed_width) + 1; // Add space between val and suffix.
+  void GameInterface::updateDisplay(uint8_t lane, bool update_score){
+    const LaneState& state = lanes_[lane];
 
     // Create labels and divider for all values.
     if(!first_score_update_){
-      lcd_.clear();
-      lcd_.setCursor(time_label_x_y, time_label_x_y);
-      lcd_.print(F("Time Left:"));
-      lcd_.setCursor(suffix_pos, time_value_y);
-      lcd_.print(F("secs"));
-      lcd_.setCursor(separator_x, separator_y);
-      lcd_.print(F("--------"));
-      lcd_.setCursor(score_label_x, score_label_y);
-      lcd_.print(F("SCORE:"));
-      lcd_.setCursor(suffix_pos, score_value_y);
-      lcd_.print(F("pnts"));
-
+      drawLabels();
       first_score_update_ = true;
     }
+
+    // Single lane keeps labels on the left; Lanes use their own region.
+    uint8_t value_x = (settings_.lanes == 1) ? OFFSET_POS : lane * (LCD_COLUMNS / settings_.lanes);
     
     // Update remaining time.
-    lcd_.setCursor(time_value_x, time_value_y);
-    uint8_t r_time = (start_time_ == 0) ? 60 : floor((millis()-start_time_)/SECOND);
-    lcd_.print(u8x8_u8toa(r_time, fixed_width));
+    lcd_.setCursor(value_x, VALUE_POS);
+    unsigned long elapsed = state.started ? min(millis() - state.start_time, settings_.game_duration) : 0;
+    uint8_t r_time = (settings_.game_duration - elapsed) / SECOND;
+    lcd_.print(u8x8_u8toa(r_time, SCORE_WIDTH));
 
     // Update score as necessary.
     if(update_score){
-      lcd_.setCursor(score_value_x, score_value_y);
-      lcd_.print(u8x8_u8toa(player_score_, fixed_width));
+      lcd_.setCursor(value_x, VALUE_POS * 2);
+      lcd_.print(u8x8_u8toa(state.score, SCORE_WIDTH));
     };
     
   }
 
-  void GameInterface::endGame(GameResult res){
+  void GameInterface::drawLabels(){
+    lcd_.clear();
+
+    if (settings_.lanes == 1){
+      for (const LcdLabel& entry: GAME_LABELS){
+        // Copy entry out of flash before use.
+        LcdLabel label;
+        memcpy_P(&label, &entry, sizeof(label));
+        lcd_.setCursor(label.x, label.y);
+        lcd_.print(reinterpret_cast<const __FlashStringHelper*>(label.text));
+      }
+      return;
+    }
+
+    // Multi-lane: "Pn" header and divider per column region.
+    uint8_t width = LCD_COLUMNS / settings_.lanes;
+    for (uint8_t lane = 0; lane < settings_.lanes; lane++){
+      lcd_.setCursor(lane * width, LABEL_POS);
+      lcd_.print('P');
+      lcd_.print(lane + 1);
+      lcd_.setCursor(lane * width, VALUE_POS + 1);
+      for (uint8_t i = 0; i + 1 < width; i++){
+        lcd_.print('-');
+      }
+    }
+  }
+
+  void GameInterface::endGame(){
     lcd_.clear();
-    uint8_t message_pos_ = value_pos_*2;
-    uint8_t high_score_pos_ = value_pos_ * 3;
-    uint8_t fixed_width  = 3;             // Of the format "xx"
-    uint8_t nv_mem_addr = 0;              // Address in EEPROM of non-volatile memory. Holds higest score.
-
-    lcd_.setCursor(start_pos_, label_pos_);
-    lcd_.print(F("Final Score: "));
-    lcd_.setCursor(offset_pos_, value_pos_);
-    lcd_.print(u8x8_u8toa(player_score_, fixed_width));
-
-    lcd_.setCursor(start_pos_, message_pos_);
-    if (res == GameResult::Win){
-      lcd_.print(F("YOU WIN!!"));
+    constexpr uint8_t message_pos    = VALUE_POS * 2;
+    constexpr uint8_t high_score_pos = VALUE_POS * 3;
+    constexpr uint8_t fixed_width    = 3;   // Of the format "xxx"
+    constexpr uint8_t nv_mem_addr    = EEPROM_HIGH_SCORE;
+    constexpr uint8_t react_width    = 4;   // Of the format "xxxx" in ms.
+    constexpr uint16_t react_max     = 9999;
+
+    uint8_t best_score = 0;
+    for (uint8_t lane = 0; lane < settings_.lanes; lane++){
+      best_score = max(best_score, lanes_[lane].score);
+    }
+
+    if (settings_.lanes == 1){
+      const LaneState& state = lanes_[0];
+
+      lcd_.setCursor(START_POS, LABEL_POS);
+      lcd_.print(F("Final Score: "));
+      lcd_.setCursor(OFFSET_POS, VALUE_POS);
+      lcd_.print(u8x8_u8toa(state.score, fixed_width));
+
+      lcd_.setCursor(START_POS, message_pos);
+      if (state.score >= settings_.win_score){
+        lcd_.print(F("YOU WIN!!"));
+      }else{
+        // Let's be nice for the kiddos.
+        lcd_.print(F("Great Try!"));
+      }
+
+      // Reaction times. Of the format "Avg React:xxxxms" and "Mn xxxx P95 xxxx".
+      uint16_t react_mean = min(state.reactions.mean()    / MILLISECOND_US, react_max);
+      uint16_t react_min  = min(state.reactions.fastest() / MILLISECOND_US, react_max);
+      uint16_t react_p95  = min(state.reactions.p95()     / MILLISECOND_US, react_max);
+
+      lcd_.setCursor(START_POS, message_pos + 1);
+      lcd_.print(F("Avg React:"));
+      lcd_.print(u8x8_u16toa(react_mean, react_width));
+      lcd_.print(F("ms"));
+      lcd_.setCursor(START_POS, high_score_pos + 1);
+      lcd_.print(F("Mn "));
+      lcd_.print(u8x8_u16toa(react_min, react_width));
+      lcd_.print(F(" P95 "));
+      lcd_.print(u8x8_u16toa(react_p95, react_width));
     }else{
-      // Let's be nice for the kiddos.
-      lcd_.print(F("Great Try!"));
+      lcd_.setCursor(START_POS, LABEL_POS);
+      lcd_.print(F("Final Scores:"));
+      lcd_.setCursor(START_POS, LABEL_POS + 1);
+      lcd_.print(F("   Pts    Avg ms"));
+
+      // One row per lane. Of the format "Pn xxx WIN  xxxx".
+      for (uint8_t lane = 0; lane < settings_.lanes; lane++){
+        const LaneState& state = lanes_[lane];
+        uint16_t react_mean = min(state.reactions.mean() / MILLISECOND_US, react_max);
+
+        lcd_.setCursor(START_POS, VALUE_POS + lane);
+        lcd_.print('P');
+        lcd_.print(lane + 1);
+        lcd_.print(' ');
+        lcd_.print(u8x8_u8toa(state.score, fixed_width));
+        lcd_.print((state.score >= settings_.win_score) ? F(" WIN  ") : F("      "));
+        lcd_.print(u8x8_u16toa(react_mean, react_width));
+      }
     }
 
     /// @todo implement more robust leaderboard system.
     size_t highest_score = EEPROM.read(nv_mem_addr);
 
-    lcd_.setCursor(start_pos_, high_score_pos_);
-    if(highest_score < player_score_ || highest_score == 0 ){
+    lcd_.setCursor(START_POS, high_score_pos);
+    if(highest_score < best_score || highest_score == 0 ){
       lcd_.print(F("New High Score!"));
-      EEPROM.write(nv_mem_addr, player_score_);
+      EEPROM.write(nv_mem_addr, best_score);
     }else{
       lcd_.print(F("High Score: "));
-      lcd_.print(player_score_);
+      lcd_.print(highest_score);
+    }
+
+    for (uint8_t lane = 0; lane < settings_.lanes; lane++){
+      const ReactionStats& reactions = lanes_[lane].reactions;
+
+      Serial.print(F("--------- Lane "));
+      Serial.print(lane + 1);
+      Serial.println(F(" Reaction Times (us) ---------"));
+      Serial.print(F("Score: "));
+      Serial.println(lanes_[lane].score);
+      Serial.print(F("Hits: "));
+      Serial.println(reactions.count());
+      Serial.print(F("Mean: "));
+      Serial.println(reactions.mean());
+      Serial.print(F("Min: "));
+      Serial.println(reactions.fastest());
+      Serial.print(F("P95: "));
+      Serial.println(reactions.p95());
     }
 
+    // Persist game events now that play is over.
+    journal_ifc_.endGame();
+    journal_ifc_.flush();
+
     do {
       // absolutely nothing. Force reset. :)
       port_ifc_.flashLEDs();
@@ -12,6 +12,9 @@
 #include "Types.h"
 #include "stdint.h"
 #include "PortAccess.h"
+#include "ReactionStats.h"
+#include "Profile.h"
+#include "Journal.h"
 
 using Targets             = types::Targets;
 using LEDs                = types::LEDs;
@@ -20,10 +23,48 @@ using OutputPorts         = types::OutputPorts;
 using InputPorts          = types::InputPorts;
 using PortAccessInterface = port_access::PortAccessInterface;
 using GameResult          = types::GameResult;
+using ReactionStats       = stats::ReactionStats;
+using ProfileInterface    = profile::ProfileInterface;
+using JournalInterface    = journal::JournalInterface;
+using GameSettings        = types::GameSettings;
+using TargetMask          = types::TargetMask;
 
 using namespace types;
 
-namespace game { class GameInterface{
+namespace benchmark { class BenchmarkInterface; }
+
+#ifdef TARGET_GAME_BENCHMARK
+// Same controller and command set as the real display, but every byte is
+// dropped instead of sent over I2C. Keeps bus time out of display benchmarks.
+class U8X8_SH1106_128X64_NONAME_NULL : public U8X8 {
+
+  public:
+  // Reset pin is accepted for parity with the HW_I2C driver and ignored.
+  U8X8_SH1106_128X64_NONAME_NULL(uint8_t /* reset */ = U8X8_PIN_NONE) : U8X8() {
+    u8x8_Setup(getU8x8(), u8x8_d_sh1106_128x64_noname, u8x8_cad_ssd13xx_fast_i2c, u8x8_byte_empty, u8x8_dummy_cb);
+  }
+};
+using LcdDriver           = U8X8_SH1106_128X64_NONAME_NULL;
+#else
+using LcdDriver           = U8X8_SH1106_128X64_NONAME_HW_I2C;
+#endif
+
+namespace game {
+
+  // Per-player state. One per lane; See types::MAX_LANES.
+  struct LaneState {
+    unsigned long start_time;       // in ms.
+    bool          started;          // Single lane starts with the start button; Others on first "hit".
+    bool          finished;
+    bool          multiply_points;
+    uint8_t       score;
+    ReactionStats reactions;
+  };
+
+class GameInterface{
+
+  // Benchmarks time private hot paths directly.
+  friend class benchmark::BenchmarkInterface;
 
   public:
   // Constructor
@@ -53,6 +94,10 @@ namespace game { class GameInterface{
 
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Set/Update player score and target trackers.
+  /// @note       Serial profile commands are serviced while waiting for
+  ///             the start button; See Profile.h.
+  ///             Every lane is served from the same chain scan. The game
+  ///             ends once every lane's time limit has been reached.
   //////////////////////////////////////////////////////////////////////////////
   void runGame();
 
@@ -67,10 +112,44 @@ namespace game { class GameInterface{
   //////////////////////////////////////////////////////////////////////////////
   void setupLcd();
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Clear score, timing and reaction times of all lanes.
+  //////////////////////////////////////////////////////////////////////////////
+  void resetLanes();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the lane a target belongs to.
+  /// @param[in]  target - Target Identifier.
+  /// @return     Lane index or `settings_.lanes` if target is unassigned.
+  //////////////////////////////////////////////////////////////////////////////
+  uint8_t laneOf(Targets target);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Start timing a lane.
+  /// @param[in]  lane - Lane index.
+  /// @param[in]  now - Start time in ms.
+  //////////////////////////////////////////////////////////////////////////////
+  void startLane(uint8_t lane, unsigned long now);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Finish lanes that have reached their time limit.
+  /// @param[in]  now - Current time in ms.
+  /// @return     Whether any lane is still in play or waiting to start.
+  /// @note       Lanes that never start expire one game duration after
+  ///             the start button is pressed.
+  //////////////////////////////////////////////////////////////////////////////
+  bool updateLanes(unsigned long now);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Light the LEDs of every lane that has not finished.
+  /// @note       Single shift of the LED chain.
+  //////////////////////////////////////////////////////////////////////////////
+  void updateLaneLeds();
+
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Determine eligibility of target hit;
   /// @param[in]  t_hit - Hit Target Identifier.
-  /// @param[in]  now - Time when parent `updateScore` called in ms.
+  /// @param[in]  now - Frame latch time of "hit" in us.
   /// @return     Whether the required "cooldown" time has passed since
   ///             target last hit.
   //////////////////////////////////////////////////////////////////////////////
@@ -78,50 +157,62 @@ namespace game { class GameInterface{
 
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Update player score based on target "hit" and target's value.
+  ///             Records reaction time of valid "hits".
+  /// @param[in]  lane - Lane of hit target.
   /// @param[in]  t_hit - Hit Target Identifier.
+  /// @return     Whether the "hit" scored; False if target is cooling down.
+  /// @note       A target is "active" from game start or once its cooldown
+  ///             expires; Reaction time is measured from then to the latch
+  ///             of the frame the "hit" was detected in.
   //////////////////////////////////////////////////////////////////////////////
-  void updateScore(Targets t_hit);
+  bool updateScore(uint8_t lane, Targets t_hit);
 
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Update player score and remaining time on display.
+  /// @param[in]  lane - Lane to update. Each lane owns an equal column
+  ///             region of the LCD.
   /// @param[in]  update_score - Whether the LCD needs to update score.
   //////////////////////////////////////////////////////////////////////////////
-  void updateDisplay(bool update_score);
+  void updateDisplay(uint8_t lane, bool update_score);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Draw static labels and dividers for all lanes.
+  //////////////////////////////////////////////////////////////////////////////
+  void drawLabels();
 
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Post-game visual cues.
-  /// @param[in]  res - Result of game based on "Win" and "Lose" criteria.
-  /// @note       Forces system reset to play again.
+  /// @note       Result of each lane is based on "Win" and "Lose" criteria.
+  ///             Forces system reset to play again.
   //////////////////////////////////////////////////////////////////////////////
-  void endGame(GameResult res);
+  void endGame();
 
   //
   // Member Variables
   //
 
   // Score
-  uint8_t player_score_;
-  uint8_t target_value_;
-  Array<unsigned long, types::TOTAL_TARGETS> last_hit_time_;
+  Array<LaneState, types::MAX_LANES> lanes_;
+  Array<unsigned long, types::TOTAL_TARGETS> last_hit_time_;   // in us.
 
   // Timing
   bool start_game_;
-  unsigned long start_time_;
-  
-  // Enhancements
-  bool multiply_points_;
-  uint8_t point_multiplier_;
-  unsigned long bonus_time_start_;
-  unsigned long bonus_time_end;
+  unsigned long arm_time_;                                   // Start button press in ms.
 
   // LCD
-  U8X8_SH1106_128X64_NONAME_HW_I2C lcd_;                     // See: (https://github.com/olikraus/u8g2/wiki/u8x8setupcpp#sh1106-128x64_noname-1); Uses MUCH less dynamic mem.
-  uint8_t start_pos_, offset_pos_, label_pos_, value_pos_;   // Positions for text-based LCD graphics.
-  bool first_score_update_;
+  LcdDriver lcd_;                                            // See: (https://github.com/olikraus/u8g2/wiki/u8x8setupcpp#sh1106-128x64_noname-1); Uses MUCH less dynamic mem.
+  bool first_score_update_;                                  // Layout positions are constexpr in Game.cpp.
 
   // Port Access
   PortAccessInterface port_ifc_;
 
+  // Profile
+  ProfileInterface profile_ifc_;
+  GameSettings settings_;                                    // Read by game loop; Only changed between games.
+
+  // Analytics
+  JournalInterface journal_ifc_;
+
 
 };} // namespace game
 #endif
\ No newline at end of file
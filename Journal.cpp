@@ -0,0 +1,170 @@
+#pragma once
+#ifndef JOURNALFILE_CPP
+#define JOURNALFILE_CPP
+
+#include "Journal.h"
+#include <EEPROM.h>
+
+constexpr uint16_t JOURNAL_RING     = EEPROM_SIZE - EEPROM_JOURNAL;
+constexpr uint8_t  END_RECORD_BYTES = 1 + 5 + 1;   // Header, worst case delta, dropped count.
+
+namespace journal {
+
+  // Constructor
+  JournalInterface::JournalInterface():
+    length_(0),
+    dropped_(0),
+    last_event_(0),
+    head_(0),
+    tail_(0)
+  {}
+
+  void JournalInterface::begin(){
+    EEPROM.get(EEPROM_JOURNAL_HEAD, head_);
+    EEPROM.get(EEPROM_JOURNAL_TAIL, tail_);
+
+    // Erased EEPROM reads 0xFFFF.
+    if (head_ >= JOURNAL_RING || tail_ >= JOURNAL_RING){
+      head_ = 0;
+      tail_ = 0;
+      saveRing();
+    }
+  }
+
+  void JournalInterface::startGame(uint8_t lanes, uint8_t slot, unsigned long waited){
+    length_     = 0;
+    dropped_    = 0;
+    last_event_ = millis();
+
+    unsigned long waited_s = waited / SECOND;
+    if (record(Event::Game_Start, lanes, 1 + varintSize(waited_s))){
+      buffer_[length_++] = slot;
+      putVarint(waited_s);
+    }
+  }
+
+  void JournalInterface::recordHit(Targets target, uint8_t points){
+    if (record(Event::Hit, static_cast<uint8_t>(target), 1)){
+      buffer_[length_++] = points;
+    }
+  }
+
+  void JournalInterface::recordReject(Targets target){
+    record(Event::Reject, static_cast<uint8_t>(target), 0);
+  }
+
+  void JournalInterface::endGame(){
+    if (record(Event::Game_End, 0, 1)){
+      buffer_[length_++] = dropped_;
+    }
+  }
+
+  void JournalInterface::flush(){
+    if (length_ == 0){
+      return;
+    }
+
+    // Stream batch. Of the format "JOURNAL <hex>".
+    Serial.print(F("JOURNAL "));
+    for (uint8_t i = 0; i < length_; i++){
+      if (buffer_[i] < 0x10){
+        Serial.print('0');
+      }
+      Serial.print(buffer_[i], HEX);
+    }
+    Serial.println();
+
+    // Make room by dropping oldest batches. One byte stays free so a full
+    // ring can be told apart from an empty one.
+    uint16_t need = length_ + 1;
+    uint16_t used = (head_ + JOURNAL_RING - tail_) % JOURNAL_RING;
+    while (JOURNAL_RING - 1 - used < need){
+      uint8_t oldest = EEPROM.read(address(tail_));
+      tail_ = (tail_ + 1 + oldest) % JOURNAL_RING;
+      used  = (head_ + JOURNAL_RING - tail_) % JOURNAL_RING;
+    }
+
+    // Append batch as <length> <records>.
+    EEPROM.update(address(head_), length_);
+    for (uint8_t i = 0; i < length_; i++){
+      EEPROM.update(address(head_ + 1 + i), buffer_[i]);
+    }
+    head_ = (head_ + need) % JOURNAL_RING;
+    saveRing();
+
+    length_ = 0;
+  }
+
+  void JournalInterface::handleCommand(){
+    if (!Serial.available()){
+      return;
+    }
+
+    char cmd = Serial.peek();
+    if (cmd == JOURNAL_DUMP){
+      Serial.read();
+      uint16_t used = (head_ + JOURNAL_RING - tail_) % JOURNAL_RING;
+
+      Serial.write(JOURNAL_ACK);
+      Serial.write(static_cast<uint8_t>(used & 0xFF));
+      Serial.write(static_cast<uint8_t>(used >> 8));
+      for (uint16_t i = 0; i < used; i++){
+        Serial.write(EEPROM.read(address(tail_ + i)));
+      }
+    }else if (cmd == JOURNAL_CLEAR){
+      Serial.read();
+      head_ = 0;
+      tail_ = 0;
+      saveRing();
+      Serial.write(JOURNAL_ACK);
+    }
+  }
+
+// Private Functions
+  bool JournalInterface::record(Event event, uint8_t arg, uint8_t payload){
+    unsigned long now   = millis();
+    unsigned long delta = now - last_event_;
+
+    // Always leave room to close the batch.
+    uint8_t limit = (event == Event::Game_End) ? JOURNAL_BYTES : JOURNAL_BYTES - END_RECORD_BYTES;
+    if (length_ + 1 + varintSize(delta) + payload > limit){
+      if (dropped_ < UINT8_MAX){
+        dropped_++;
+      }
+      return false;
+    }
+
+    last_event_ = now;
+    buffer_[length_++] = (static_cast<uint8_t>(event) << 4) | (arg & 0x0F);
+    putVarint(delta);
+    return true;
+  }
+
+  uint8_t JournalInterface::varintSize(unsigned long value){
+    uint8_t size = 1;
+    while (value >>= 7){
+      size++;
+    }
+    return size;
+  }
+
+  void JournalInterface::putVarint(unsigned long value){
+    while (value >= 0x80){
+      buffer_[length_++] = static_cast<uint8_t>(value) | 0x80;
+      value >>= 7;
+    }
+    buffer_[length_++] = static_cast<uint8_t>(value);
+  }
+
+  uint16_t JournalInterface::address(uint16_t offset){
+    return EEPROM_JOURNAL + (offset % JOURNAL_RING);
+  }
+
+  void JournalInterface::saveRing(){
+    EEPROM.put(EEPROM_JOURNAL_HEAD, head_);
+    EEPROM.put(EEPROM_JOURNAL_TAIL, tail_);
+  }
+
+} // namespace journal
+
+#endif
@@ -0,0 +1,147 @@
+#pragma once
+#ifndef JOURNALFILE_H
+#define JOURNALFILE_H
+
+// Arduino Libs
+#include <Arduino.h>
+
+// Custom Libs
+#include "Types.h"
+#include "stdint.h"
+
+using Targets = types::Targets;
+
+using namespace types;
+
+namespace journal {
+
+  // Event record: header byte (event << 4 | argument), delta time since
+  // previous event in ms (LEB128), then payload.
+  //   Game_Start : arg = lanes,  payload = profile slot, wait in s (LEB128).
+  //   Hit        : arg = target, payload = points awarded.
+  //   Reject     : arg = target. Hit during cooldown; Counted once per "hit".
+  //   Game_End   : arg = 0,      payload = events dropped (buffer full).
+  enum class Event: uint8_t {
+    Game_Start = 1,
+    Hit        = 2,
+    Reject     = 3,
+    Game_End   = 4,
+  };
+
+  constexpr uint8_t JOURNAL_BYTES = 192;   // One game; Events past this are dropped.
+
+  // Serial commands; Replies start with JOURNAL_ACK.
+  //   'J' : Reply JOURNAL_ACK, byte count (uint16), then every stored batch
+  //         oldest first, each as <length> <records>.
+  //   'C' : Erase stored batches.
+  constexpr char JOURNAL_DUMP  = 'J';
+  constexpr char JOURNAL_CLEAR = 'C';
+  constexpr char JOURNAL_ACK   = 'K';
+
+class JournalInterface{
+
+  public:
+  // Constructor
+  JournalInterface();
+
+  // Destructor
+  ~JournalInterface() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Load EEPROM ring position. Resets an erased or invalid ring.
+  //////////////////////////////////////////////////////////////////////////////
+  void begin();
+
+  //
+  // Recording
+  // Constant time RAM writes only; Never called from the scan path.
+  //
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Begin a new game batch.
+  /// @param[in]  lanes - Lanes in play.
+  /// @param[in]  slot - Active profile slot.
+  /// @param[in]  waited - Time from booth ready to start button in ms.
+  //////////////////////////////////////////////////////////////////////////////
+  void startGame(uint8_t lanes, uint8_t slot, unsigned long waited);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Record a scored "hit".
+  /// @param[in]  target - Target Identifier.
+  /// @param[in]  points - Points awarded; Score change of target's lane.
+  //////////////////////////////////////////////////////////////////////////////
+  void recordHit(Targets target, uint8_t points);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Record a "hit" rejected by target cooldown.
+  /// @param[in]  target - Target Identifier.
+  //////////////////////////////////////////////////////////////////////////////
+  void recordReject(Targets target);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Close the current game batch.
+  //////////////////////////////////////////////////////////////////////////////
+  void endGame();
+
+  //
+  // Between games
+  //
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Stream the batch over serial as a "JOURNAL <hex>" line and
+  ///             append it to the EEPROM ring, overwriting oldest batches.
+  /// @note       EEPROM writes take ~3.3 ms per byte; Only use between games.
+  //////////////////////////////////////////////////////////////////////////////
+  void flush();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Service a pending journal serial command, if any.
+  /// @note       Leaves other commands unread.
+  //////////////////////////////////////////////////////////////////////////////
+  void handleCommand();
+
+  //
+  // Private functions
+  //
+  private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Append event header and delta time.
+  /// @param[in]  event - Event type.
+  /// @param[in]  arg - 4-bit event argument.
+  /// @param[in]  payload - Payload bytes that will follow.
+  /// @return     Whether the event fits. Dropped events are counted.
+  //////////////////////////////////////////////////////////////////////////////
+  bool record(Event event, uint8_t arg, uint8_t payload);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the encoded size of an unsigned LEB128 value.
+  /// @param[in]  value - Value to encode.
+  /// @return     Size in bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  uint8_t varintSize(unsigned long value);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Append an unsigned LEB128 value.
+  /// @param[in]  value - Value to append.
+  //////////////////////////////////////////////////////////////////////////////
+  void putVarint(unsigned long value);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Map a ring offset to an EEPROM address.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t address(uint16_t offset);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Persist ring position.
+  //////////////////////////////////////////////////////////////////////////////
+  void saveRing();
+
+  //
+  // Member Variables
+  //
+  uint8_t buffer_[JOURNAL_BYTES];
+  uint8_t length_;
+  uint8_t dropped_;
+  unsigned long last_event_;    // in ms.
+  uint16_t head_, tail_;        // EEPROM ring offsets; Next write and oldest batch.
+
+};} // namespace journal
+#endif
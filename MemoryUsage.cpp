@@ -0,0 +1,77 @@
+#pragma once
+#ifndef MEMORYUSAGEFILE_CPP
+#define MEMORYUSAGEFILE_CPP
+
+#include "MemoryUsage.h"
+
+// Linker provided section boundaries.
+// See: (https://www.nongnu.org/avr-libc/user-manual/mem_sections.html)
+extern uint8_t __data_start;
+extern uint8_t __data_end;
+extern uint8_t __bss_start;
+extern uint8_t __bss_end;
+extern uint8_t _end;
+extern uint8_t __stack;
+
+// Fill all SRAM between the end of .bss and the top of the stack with
+// STACK_CANARY before any constructor or main() runs. Written in assembly
+// as r1 (zero register) and the stack pointer are not yet set up in .init1.
+void paintStack() __attribute__((naked, used, section(".init1")));
+
+void paintStack(){
+  __asm volatile (
+    "    ldi r30, lo8(_end)      \n"
+    "    ldi r31, hi8(_end)      \n"
+    "    ldi r24, %0             \n"
+    "    ldi r25, hi8(__stack)   \n"
+    "    rjmp 2f                 \n"
+    "1:  st Z+, r24              \n"
+    "2:  cpi r30, lo8(__stack)   \n"
+    "    cpc r31, r25            \n"
+    "    brlo 1b                 \n"
+    "    breq 1b                 \n"
+    :: "M" (memory_usage::STACK_CANARY)
+  );
+}
+
+namespace memory_usage {
+
+  uint16_t dataSize(){
+    return &__data_end - &__data_start;
+  }
+
+  uint16_t bssSize(){
+    return &__bss_end - &__bss_start;
+  }
+
+  uint16_t stackHighWater(){
+    return (&__stack - &_end + 1) - stackHeadroom();
+  }
+
+  uint16_t stackHeadroom(){
+    // First overwritten byte above .bss marks the deepest stack frame.
+    // Nothing in this sketch uses the heap, so nothing else writes here.
+    const uint8_t* p = &_end;
+    while (p <= &__stack && *p == STACK_CANARY){
+      p++;
+    }
+    return p - &_end;
+  }
+
+  void printReport(){
+    Serial.println(F("--------- Memory Usage ---------"));
+    Serial.print(F(".data (bytes): "));
+    Serial.println(dataSize());
+    Serial.print(F(".bss (bytes): "));
+    Serial.println(bssSize());
+    Serial.print(F("Stack high-water (bytes): "));
+    Serial.println(stackHighWater());
+    Serial.print(F("Stack headroom (bytes): "));
+    Serial.println(stackHeadroom());
+    Serial.println(F(""));
+    Serial.println(F(""));
+  }
+
+} // namespace memory_usage
+
+#endif
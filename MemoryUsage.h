@@ -0,0 +1,49 @@
+#pragma once
+#ifndef MEMORYUSAGEFILE_H
+#define MEMORYUSAGEFILE_H
+
+// Arduino Libs
+#include <Arduino.h>
+
+// Custom Libs
+#include "stdint.h"
+
+namespace memory_usage {
+
+  // Byte written over all free SRAM at boot. See: paintStack() in MemoryUsage.cpp.
+  constexpr uint8_t STACK_CANARY = 0xC5;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the size of initialized static data (.data).
+  /// @return     Size in bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t dataSize();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the size of zero-initialized static data (.bss).
+  /// @return     Size in bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t bssSize();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the deepest stack usage seen since boot.
+  /// @return     Size in bytes.
+  /// @note       Scans painted SRAM from the end of .bss upward; Cost grows
+  ///             with free memory. Do not call during a game.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t stackHighWater();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the SRAM never touched by the stack since boot.
+  /// @return     Size in bytes.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t stackHeadroom();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Print .data, .bss, stack high-water mark and headroom over
+  ///             serial.
+  //////////////////////////////////////////////////////////////////////////////
+  void printReport();
+
+} // namespace memory_usage
+#endif
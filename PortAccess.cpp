@@ -4,7 +4,11 @@
 
 #include "PortAccess.h"
 
+#ifdef TARGET_GAME_BENCHMARK
+constexpr uint8_t POST_READ_WAIT = 0;  // Keep the wait out of scan timings.
+#else
 constexpr uint8_t POST_READ_WAIT = 10; // Helps avoid false positive reads.
+#endif
 
 namespace port_access {
 
@@ -15,7 +19,8 @@ namespace port_access {
     tlp_(static_cast<uint8_t>(OutputPorts::Targets_Latch_Pin)),
     ldp_(static_cast<uint8_t>(OutputPorts::LEDs_Data_Pin)),
     lcp_(static_cast<uint8_t>(OutputPorts::LEDs_Clock_Pin)),
-    llp_(static_cast<uint8_t>(OutputPorts::LEDs_Latch_Pin))
+    llp_(static_cast<uint8_t>(OutputPorts::LEDs_Latch_Pin)),
+    frame_time_(0)
   {
     led_register_.fill(EnaDis::Disabled);
     
@@ -23,8 +28,9 @@ namespace port_access {
   }
 
   EnaDis PortAccessInterface::getTargetState(Targets target){
-    // Compare desired target to actual target "hit" detected, if any.
-    return (target == sampleInputs())? EnaDis::Enabled : EnaDis::Disabled;
+    // Check desired target against all targets "hit" detected, if any.
+    TargetMask mask = static_cast<TargetMask>(1) << static_cast<uint8_t>(target);
+    return (sampleInputs() & mask)? EnaDis::Enabled : EnaDis::Disabled;
   }
 
 
@@ -38,10 +44,28 @@ namespace port_access {
   bool PortAccessInterface::targetHit(Targets& t_hit){
     // Read target inputs. Store first target "hit" detected or Targets::TOTAL
     // if no "hits" detected.
-    t_hit =  sampleInputs();
+    TargetMask hits = sampleInputs();
+    t_hit = (hits)? static_cast<Targets>(__builtin_ctz(hits)) : Targets::TOTAL;
 
     // Return whether any target "hit" was detected.
-    return (t_hit == Targets::TOTAL);
+    return (t_hit != Targets::TOTAL);
+  }
+
+  TargetMask PortAccessInterface::targetFrame(){
+    return sampleInputs();
+  }
+
+  void PortAccessInterface::setLedFrame(TargetMask mask){
+    // Update states in LED array.
+    for (uint8_t i = 0; i < TOTAL_LEDS; i++){
+      led_register_[i] = (mask & (static_cast<TargetMask>(1) << i))? EnaDis::Enabled : EnaDis::Disabled;
+    }
+    // Send information to physical components.
+    updateLeds();
+  }
+
+  unsigned long PortAccessInterface::frameTime() const{
+    return frame_time_;
   }
 
   bool PortAccessInterface::sampleStartButton(){
@@ -166,20 +190,34 @@ namespace port_access {
       pinMode(static_cast<uint8_t>(out_port), OUTPUT);
     }
 
+#ifdef TARGET_GAME_ANALOG_SENSORS
+    // Start sampling now so baselines settle before targets are verified.
+    analog_ifc_.begin();
+#endif
+
   }
 
-  Targets PortAccessInterface::sampleInputs()
+  TargetMask PortAccessInterface::sampleInputs()
   {
+    TargetMask hits = 0;
+
+#ifdef TARGET_GAME_ANALOG_SENSORS
+    // Sensors are sampled continuously by the ADC; Latch what was seen.
+    frame_time_ = micros();
+    hits = analog_ifc_.frame();
+#else
     // Read in all target input at once.
     digitalWrite(tlp_, LOW);
     digitalWrite(tlp_, HIGH);
+    // Inputs are frozen from here; Stamp the frame.
+    frame_time_ = micros();
 
     // Read inputs one bit at a time. LSB -> MSB.
     for (uint8_t i = 0; i < TOTAL_TARGETS; i++){
 
-      // Return first HIGH ("hit") signal detected.
+      // Record every HIGH ("hit") signal detected.
       if(digitalRead(tdp_)){
-        return static_cast<Targets>(i);
+        hits |= static_cast<TargetMask>(1) << i;
       }
 
       // Pop read bit. Continue iteration with next
@@ -189,10 +227,12 @@ namespace port_access {
     }
 
     // Ensure registers have time to clear before next read.
-    delay(POST_READ_WAIT);
+    if (!hits && POST_READ_WAIT){
+      delay(POST_READ_WAIT);
+    }
+#endif
 
-    // Return invalid identifier if no "hit" detected.
-    return Targets::TOTAL;
+    return hits;
   };
 
   void PortAccessInterface::updateLeds()
@@ -201,7 +241,7 @@ namespace port_access {
     digitalWrite(llp_, LOW);
 
     // Push in states for all LEDs. MSB -> LSB.
-    for (uint8_t i = TOTAL_LEDS - 1; i >= 0; i--) {
+    for (uint8_t i = TOTAL_LEDS; i-- > 0;) {
       // Prep SR to receive bit.
       digitalWrite(lcp_, LOW);
       // Send bit to SR.
@@ -10,6 +10,7 @@
 // Custom Libs
 #include "Types.h"
 #include "stdint.h"
+#include "AnalogSensors.h"
 
 using Targets     = types::Targets;
 using LEDs        = types::LEDs;
@@ -19,8 +20,13 @@ using InputPorts  = types::InputPorts;
 
 using namespace types;
 
+namespace benchmark { class BenchmarkInterface; }
+
 namespace port_access { class PortAccessInterface{
 
+  // Benchmarks time private hot paths directly.
+  friend class benchmark::BenchmarkInterface;
+
   public:
   // Constructor
   PortAccessInterface();
@@ -54,6 +60,26 @@ namespace port_access { class PortAccessInterface{
   //////////////////////////////////////////////////////////////////////////////
   bool targetHit(Targets& t_hit);
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the state of all target inputs in a single chain scan.
+  /// @return     Mask of every target "hit" in the frame; Bit n is Targets n.
+  //////////////////////////////////////////////////////////////////////////////
+  TargetMask targetFrame();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Set the state of all LEDs with a single chain shift.
+  /// @param[in]  mask - Enabled LEDs; Bit n is LEDs n.
+  //////////////////////////////////////////////////////////////////////////////
+  void setLedFrame(TargetMask mask);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Get the time the most recent scan frame was latched.
+  /// @return     Latch time in us (See: micros()).
+  /// @note       Use to timestamp a "hit" returned by `targetHit`
+  ///             independent of how long the caller took to handle it.
+  //////////////////////////////////////////////////////////////////////////////
+  unsigned long frameTime() const;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @details   Get the state of InputPorts::Start_Button.
   /// @return    Whether the start button was pressed. 
@@ -95,9 +121,12 @@ namespace port_access { class PortAccessInterface{
 
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Read in all target input states.
-  /// @return     Identifier of first target "hit" detected or Targets::TOTAL. 
+  /// @return     Mask of every target "hit" detected; 0 if none.
+  /// @note       Always shifts the full chain so all lanes share one scan.
+  ///             With TARGET_GAME_ANALOG_SENSORS, latches the ADC results
+  ///             instead; See AnalogSensors.h.
   //////////////////////////////////////////////////////////////////////////////
-  Targets sampleInputs();
+  TargetMask sampleInputs();
 
   //////////////////////////////////////////////////////////////////////////////
   /// @details    Set all LED states.
@@ -110,6 +139,10 @@ namespace port_access { class PortAccessInterface{
   Array<EnaDis, types::TOTAL_LEDS> led_register_; // Avoid unnessecary read ops.
   uint8_t tdp_, tcp_, tlp_;                          // Target data, clock, and latch pins.
   uint8_t ldp_, lcp_, llp_;                          // LED data, clock, and latch pins.
+  unsigned long frame_time_;                         // Latch time of last scan frame in us.
+#ifdef TARGET_GAME_ANALOG_SENSORS
+  analog_sensors::AnalogSensorInterface analog_ifc_; // Replaces target chain.
+#endif
 
 };} // namespace port_access
 #endif
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+#ifndef PROFILEFILE_CPP
+#define PROFILEFILE_CPP
+
+#include "Profile.h"
+#include <stddef.h>
+#include <EEPROM.h>
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+
+// Built-in profile. Used until a valid EEPROM profile is selected.
+const GameProfile DEFAULT_PROFILE PROGMEM = {
+  profile::PROFILE_VERSION,
+  60,       // Game duration (s).
+  25,       // Win score.
+  5,        // Target value.
+  2,        // Point multiplier.
+  40,       // Bonus time starts 40 seconds after game begins.
+  50,       // Bonus time ends 10 seconds after it begins.
+  1,        // Single lane (player).
+  3000,     // Hit cooldown (ms).
+  500,      // Initialization wait (ms).
+  0,        // CRC unused for built-in profile.
+};
+
+namespace profile {
+
+  // Constructor
+  ProfileInterface::ProfileInterface():
+    active_slot_(PROFILE_SLOTS)
+  {}
+
+  void ProfileInterface::loadDefault(GameSettings& settings){
+    GameProfile prof;
+    memcpy_P(&prof, &DEFAULT_PROFILE, sizeof(prof));
+    apply(prof, settings);
+    active_slot_ = PROFILE_SLOTS;
+  }
+
+  bool ProfileInterface::loadActive(GameSettings& settings){
+    uint8_t slot = EEPROM.read(EEPROM_ACTIVE_SLOT);
+    GameProfile prof;
+
+    // Erased EEPROM reads 0xFF; Treat as "no selection".
+    if (slot < PROFILE_SLOTS && read(slot, prof)){
+      apply(prof, settings);
+      active_slot_ = slot;
+      return true;
+    }
+
+    loadDefault(settings);
+    return false;
+  }
+
+  bool ProfileInterface::handleCommand(GameSettings& settings){
+    if (!Serial.available()){
+      return false;
+    }
+
+    char cmd = Serial.read();
+    uint8_t slot = PROFILE_SLOTS;
+    if (Serial.readBytes(&slot, sizeof(slot)) != sizeof(slot) || slot >= PROFILE_SLOTS){
+      Serial.write(PROFILE_NACK);
+      return false;
+    }
+
+    GameProfile prof;
+    switch (cmd){
+      case PROFILE_SELECT:
+        if (!read(slot, prof)){
+          break;
+        }
+        apply(prof, settings);
+        active_slot_ = slot;
+        EEPROM.update(EEPROM_ACTIVE_SLOT, slot);
+        Serial.write(PROFILE_ACK);
+        return true;
+
+      case PROFILE_WRITE:
+        if (Serial.readBytes(reinterpret_cast<uint8_t*>(&prof), sizeof(prof)) != sizeof(prof) || !valid(prof)){
+          break;
+        }
+        EEPROM.put(EEPROM_PROFILES + slot * sizeof(GameProfile), prof);
+        Serial.write(PROFILE_ACK);
+        return false;
+
+      case PROFILE_READ:
+        EEPROM.get(EEPROM_PROFILES + slot * sizeof(GameProfile), prof);
+        Serial.write(PROFILE_ACK);
+        Serial.write(reinterpret_cast<const uint8_t*>(&prof), sizeof(prof));
+        return false;
+
+      default:
+        break;
+    }
+
+    Serial.write(PROFILE_NACK);
+    return false;
+  }
+
+  uint8_t ProfileInterface::activeSlot() const{
+    return active_slot_;
+  }
+
+// Private Functions
+  void ProfileInterface::apply(const GameProfile& prof, GameSettings& settings){
+    settings.hit_cooldown     = static_cast<unsigned long>(prof.hit_cooldown) * MILLISECOND_US;
+    settings.game_duration    = static_cast<unsigned long>(prof.game_duration) * SECOND;
+    settings.bonus_start      = static_cast<unsigned long>(prof.bonus_start) * SECOND;
+    settings.bonus_end        = static_cast<unsigned long>(prof.bonus_end) * SECOND;
+    settings.init_wait        = prof.init_wait;
+    settings.win_score        = prof.win_score;
+    settings.target_value     = prof.target_value;
+    settings.point_multiplier = prof.point_multiplier;
+    settings.lanes            = prof.lanes;
+    settings.lane_size        = TOTAL_TARGETS / prof.lanes;
+  }
+
+  bool ProfileInterface::read(uint8_t slot, GameProfile& prof){
+    EEPROM.get(EEPROM_PROFILES + slot * sizeof(GameProfile), prof);
+    return valid(prof);
+  }
+
+  bool ProfileInterface::valid(const GameProfile& prof){
+    return (
+      (prof.version == PROFILE_VERSION)        &&
+      (prof.crc == checksum(prof))             &&
+      (prof.game_duration > 0)                 &&
+      (prof.game_duration < 100)               &&  // Display shows "xx" seconds.
+      (prof.bonus_start <= prof.bonus_end)     &&
+      (prof.bonus_end <= prof.game_duration)  &&
+      (prof.lanes > 0)                         &&
+      (prof.lanes <= MAX_LANES)                &&
+      (prof.win_score > 0)                     &&
+      (prof.hit_cooldown > 0)                  &&
+      (static_cast<uint16_t>(prof.target_value) * prof.point_multiplier <= UINT8_MAX)  // Points per hit are 8-bit.
+    );
+  }
+
+  uint16_t ProfileInterface::checksum(const GameProfile& prof){
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&prof);
+    uint16_t crc = 0xFFFF;
+    for (uint8_t i = 0; i < offsetof(GameProfile, crc); i++){
+      crc = _crc_ccitt_update(crc, bytes[i]);
+    }
+    return crc;
+  }
+
+} // namespace profile
+
+#endif
@@ -0,0 +1,111 @@
+#pragma once
+#ifndef PROFILEFILE_H
+#define PROFILEFILE_H
+
+// Arduino Libs
+#include <Arduino.h>
+
+// Custom Libs
+#include "Types.h"
+#include "stdint.h"
+
+using GameProfile  = types::GameProfile;
+using GameSettings = types::GameSettings;
+
+using namespace types;
+
+namespace profile {
+
+  constexpr uint8_t PROFILE_VERSION = 2;
+  constexpr uint8_t PROFILE_SLOTS   = 4;
+
+  // Serial commands. Each is a single ASCII byte followed by a binary slot
+  // index; Replies are PROFILE_ACK or PROFILE_NACK.
+  //   'S' <slot>                 : Select and apply slot. Persists over reset.
+  //   'W' <slot> <GameProfile>   : Validate and store profile in slot.
+  //   'R' <slot>                 : Reply PROFILE_ACK followed by stored profile.
+  constexpr char PROFILE_SELECT = 'S';
+  constexpr char PROFILE_WRITE  = 'W';
+  constexpr char PROFILE_READ   = 'R';
+  constexpr char PROFILE_ACK    = 'K';
+  constexpr char PROFILE_NACK   = 'E';
+
+class ProfileInterface{
+
+  public:
+  // Constructor
+  ProfileInterface();
+
+  // Destructor
+  ~ProfileInterface() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Expand built-in default profile into settings.
+  /// @param[out] settings - Settings to apply profile to.
+  //////////////////////////////////////////////////////////////////////////////
+  void loadDefault(GameSettings& settings);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Expand the selected EEPROM profile into settings.
+  /// @param[out] settings - Settings to apply profile to.
+  /// @return     Whether the stored profile was valid. Defaults are applied
+  ///             if not.
+  //////////////////////////////////////////////////////////////////////////////
+  bool loadActive(GameSettings& settings);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Service a single pending serial command, if any.
+  /// @param[out] settings - Settings to apply a newly selected profile to.
+  /// @return     Whether settings were changed.
+  /// @note       Blocks up to the serial timeout for command arguments;
+  ///             Only use between games.
+  //////////////////////////////////////////////////////////////////////////////
+  bool handleCommand(GameSettings& settings);
+
+  //
+  // Accessors
+  //
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return     Slot of the active profile or PROFILE_SLOTS if defaults.
+  //////////////////////////////////////////////////////////////////////////////
+  uint8_t activeSlot() const;
+
+  //
+  // Private functions
+  //
+  private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Expand stored profile into settings.
+  /// @param[in]  prof - Validated profile.
+  /// @param[out] settings - Settings to apply profile to.
+  //////////////////////////////////////////////////////////////////////////////
+  void apply(const GameProfile& prof, GameSettings& settings);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Read profile from EEPROM slot.
+  /// @param[in]  slot - Slot to read.
+  /// @param[out] prof - Profile read.
+  /// @return     Whether profile is valid.
+  //////////////////////////////////////////////////////////////////////////////
+  bool read(uint8_t slot, GameProfile& prof);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Check version, CRC and value ranges of a profile.
+  /// @param[in]  prof - Profile to check.
+  /// @return     Whether profile can be applied.
+  //////////////////////////////////////////////////////////////////////////////
+  bool valid(const GameProfile& prof);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Compute CRC-CCITT (init 0xFFFF) over all bytes but `crc`.
+  /// @param[in]  prof - Profile to check.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t checksum(const GameProfile& prof);
+
+  //
+  // Member Variables
+  //
+  uint8_t active_slot_;
+
+};} // namespace profile
+#endif
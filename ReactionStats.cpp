@@ -0,0 +1,133 @@
+#pragma once
+#ifndef REACTIONSTATSFILE_CPP
+#define REACTIONSTATSFILE_CPP
+
+#include "ReactionStats.h"
+#include <avr/pgmspace.h>
+
+// Desired marker positions as a fraction of samples seen for p = 0.95.
+// Markers: min, p/2, p, (1+p)/2, max.
+const float MARKER_RATE[] PROGMEM = {0.0f, 0.475f, 0.95f, 0.975f, 1.0f};
+
+// Nearest rank p95 of fewer samples is the largest; P^2 markers have not
+// had enough samples to move there yet.
+constexpr uint16_t EXACT_P95_SAMPLES = 20;
+
+namespace stats {
+
+  // Constructor
+  ReactionStats::ReactionStats()
+  {
+    reset();
+  }
+
+  void ReactionStats::reset(){
+    count_   = 0;
+    sum_     = 0;
+    fastest_ = UINT32_MAX;
+    for (uint8_t i = 0; i < MARKERS; i++){
+      height_[i] = 0;
+      pos_[i]    = i;
+    }
+  }
+
+  void ReactionStats::add(uint32_t reaction){
+    float x = reaction;
+
+    count_++;
+    sum_ += reaction;
+    if (reaction < fastest_){
+      fastest_ = reaction;
+    }
+
+    // Fill markers with first samples, kept sorted.
+    if (count_ <= MARKERS){
+      uint8_t i = count_ - 1;
+      while (i > 0 && height_[i - 1] > x){
+        height_[i] = height_[i - 1];
+        i--;
+      }
+      height_[i] = x;
+      return;
+    }
+
+    // Find cell containing sample. Extend extremes as necessary.
+    uint8_t cell = 0;
+    if (x < height_[0]){
+      height_[0] = x;
+    }else if (x >= height_[MARKERS - 1]){
+      height_[MARKERS - 1] = x;
+      cell = MARKERS - 2;
+    }else{
+      while (x >= height_[cell + 1]){
+        cell++;
+      }
+    }
+
+    // Shift positions of markers above the sample.
+    for (uint8_t i = cell + 1; i < MARKERS; i++){
+      pos_[i]++;
+    }
+
+    // Move middle markers toward their desired positions.
+    for (uint8_t i = 1; i < MARKERS - 1; i++){
+      float desired = (count_ - 1) * pgm_read_float(&MARKER_RATE[i]);
+      float offset  = desired - pos_[i];
+
+      if ((offset >= 1 && pos_[i + 1] - pos_[i] > 1) ||
+          (offset <= -1 && pos_[i - 1] - pos_[i] < -1)){
+        int8_t d = (offset > 0) ? 1 : -1;
+        float h = parabolic(i, d);
+
+        if (height_[i - 1] < h && h < height_[i + 1]){
+          height_[i] = h;
+        }else{
+          height_[i] = linear(i, d);
+        }
+        pos_[i] += d;
+      }
+    }
+  }
+
+  uint16_t ReactionStats::count() const{
+    return count_;
+  }
+
+  uint32_t ReactionStats::mean() const{
+    return (count_ == 0) ? 0 : sum_ / count_;
+  }
+
+  uint32_t ReactionStats::fastest() const{
+    return (count_ == 0) ? 0 : fastest_;
+  }
+
+  uint32_t ReactionStats::p95() const{
+    if (count_ == 0){
+      return 0;
+    }
+    // Exact while the max is the answer. Top marker tracks the exact max
+    // once all markers are filled.
+    if (count_ < EXACT_P95_SAMPLES){
+      return height_[((count_ < MARKERS) ? count_ : MARKERS) - 1];
+    }
+    return height_[2];
+  }
+
+// Private Functions
+  float ReactionStats::parabolic(uint8_t i, int8_t d) const{
+    float below = pos_[i] - pos_[i - 1];
+    float above = pos_[i + 1] - pos_[i];
+
+    return height_[i] + d / (below + above) * (
+      (below + d) * (height_[i + 1] - height_[i]) / above +
+      (above - d) * (height_[i] - height_[i - 1]) / below
+    );
+  }
+
+  float ReactionStats::linear(uint8_t i, int8_t d) const{
+    return height_[i] + d * (height_[i + d] - height_[i]) / (pos_[i + d] - pos_[i]);
+  }
+
+} // namespace stats
+
+#endif
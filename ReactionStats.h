@@ -0,0 +1,88 @@
+#pragma once
+#ifndef REACTIONSTATSFILE_H
+#define REACTIONSTATSFILE_H
+
+// Arduino Libs
+#include <Arduino.h>
+
+// Custom Libs
+#include "stdint.h"
+
+namespace stats { class ReactionStats{
+
+  public:
+  // Constructor
+  ReactionStats();
+
+  // Destructor
+  ~ReactionStats() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Clear all recorded samples.
+  //////////////////////////////////////////////////////////////////////////////
+  void reset();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Record a single reaction time.
+  /// @param[in]  reaction - Time from target becoming active to "hit" in us.
+  /// @note       Constant time and memory. p95 is estimated with the P^2
+  ///             algorithm (Jain & Chlamtac, 1985) from 20 samples on;
+  ///             Below that p95 is the exact nearest rank (the largest).
+  //////////////////////////////////////////////////////////////////////////////
+  void add(uint32_t reaction);
+
+  //
+  // Accessors
+  //
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return     Number of recorded samples.
+  //////////////////////////////////////////////////////////////////////////////
+  uint16_t count() const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return     Mean reaction time in us or 0 if no samples.
+  //////////////////////////////////////////////////////////////////////////////
+  uint32_t mean() const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return     Fastest reaction time in us or 0 if no samples.
+  //////////////////////////////////////////////////////////////////////////////
+  uint32_t fastest() const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return     95th percentile reaction time in us or 0 if no samples.
+  //////////////////////////////////////////////////////////////////////////////
+  uint32_t p95() const;
+
+  //
+  // Private functions
+  //
+  private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Piecewise-parabolic marker height prediction.
+  /// @param[in]  i - Marker index (1-3).
+  /// @param[in]  d - Direction of marker move (+1/-1).
+  //////////////////////////////////////////////////////////////////////////////
+  float parabolic(uint8_t i, int8_t d) const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @details    Linear marker height prediction. Used when the parabolic
+  ///             prediction would leave markers out of order.
+  /// @param[in]  i - Marker index (1-3).
+  /// @param[in]  d - Direction of marker move (+1/-1).
+  //////////////////////////////////////////////////////////////////////////////
+  float linear(uint8_t i, int8_t d) const;
+
+  //
+  // Member Variables
+  //
+  static constexpr uint8_t MARKERS = 5;
+
+  uint16_t count_;
+  uint32_t sum_;            // Bounded by game duration; Cannot overflow.
+  uint32_t fastest_;
+  float    height_[MARKERS];  // P^2 marker heights (us).
+  int16_t  pos_[MARKERS];     // P^2 marker positions (0-based).
+
+};} // namespace stats
+#endif
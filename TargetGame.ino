@@ -3,8 +3,27 @@
 #define MAIN
 
 #include "Game.h"
+#include "Benchmark.h"
 
-using GameInterface = game::GameInterface;
+using GameInterface      = game::GameInterface;
+using BenchmarkInterface = benchmark::BenchmarkInterface;
+
+#ifdef TARGET_GAME_BENCHMARK
+
+// Benchmark Logic
+BenchmarkInterface bench_ifc_;
+
+void setup() {
+
+  // Enable benchmark output.
+  Serial.begin(9600);
+
+  // Time hot paths. Never returns.
+  bench_ifc_.runBenchmarks();
+
+}
+
+#else
 
 // Game Logic
 GameInterface game_ifc_;
@@ -23,6 +42,8 @@ void setup() {
 
 }
 
+#endif
+
 void loop() {
 
 }
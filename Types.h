@@ -6,10 +6,31 @@
 #include <stdint.h>
 #include <Array.h>
 
+// Build Options
+// Replace the game with the AVR micro-benchmark suite (see Benchmark.h).
+// Uncomment here or pass -DTARGET_GAME_BENCHMARK to the compiler.
+// #define TARGET_GAME_BENCHMARK
+
+// Read LDRs through an analog multiplexer and the ADC instead of the
+// 74HC165 chain (see AnalogSensors.h).
+// Uncomment here or pass -DTARGET_GAME_ANALOG_SENSORS to the compiler.
+// #define TARGET_GAME_ANALOG_SENSORS
+
 namespace types {
 
   // Constants
   constexpr uint16_t SECOND = 1000; // Defined in ms.
+  constexpr uint32_t SECOND_US = 1000000UL; // Defined in us.
+  constexpr uint16_t MILLISECOND_US = SECOND_US / SECOND; // Defined in us; us -> ms divisor.
+
+  // EEPROM Layout (byte addresses).
+  constexpr uint16_t EEPROM_HIGH_SCORE   = 0;    // Highest score.
+  constexpr uint16_t EEPROM_ACTIVE_SLOT  = 1;    // Selected game profile slot.
+  constexpr uint16_t EEPROM_JOURNAL_HEAD = 2;    // Journal ring write offset (uint16).
+  constexpr uint16_t EEPROM_JOURNAL_TAIL = 4;    // Journal ring oldest batch offset (uint16).
+  constexpr uint16_t EEPROM_PROFILES     = 16;   // Game profile slots; See Profile.h.
+  constexpr uint16_t EEPROM_JOURNAL      = 128;  // Game event journal ring; See Journal.h.
+  constexpr uint16_t EEPROM_SIZE         = 1024; // ATmega328P.
 
   /// @todo Assign when values known.
   // Map Arduino pin connections to physical input components.
@@ -31,6 +52,17 @@ namespace types {
     TOTAL,
   };
 
+  /// @todo Assign when values known.
+  // Map Arduino pin connections to the analog sensor multiplexer (74HC4067).
+  // Only used with TARGET_GAME_ANALOG_SENSORS. A4/A5 are taken by I2C.
+  enum class SensorMuxPorts: uint8_t {
+    Select0 = 6,
+    Select1 = 7,
+    Select2 = 8,
+    Select3 = 9,
+    Analog_Input = 14,    // A0.
+  };
+
   // Map targets to indentifier. Requires 2 shift registers minimum.
   enum class Targets: uint8_t{
     Target1= 0,
@@ -49,6 +81,10 @@ namespace types {
   };
   constexpr uint8_t TOTAL_TARGETS = static_cast<uint8_t>(Targets::TOTAL);
 
+  // One bit per target, indexed by Targets. Holds a full chain scan.
+  using TargetMask = uint16_t;
+  static_assert(TOTAL_TARGETS <= 16, "TargetMask must hold every target.");
+
   // Map LEDs -> Target. Requires 2 shift registers minimum.
   enum class LEDs: uint8_t{
     Target1= 0,
@@ -67,6 +103,10 @@ namespace types {
   };
   constexpr uint8_t TOTAL_LEDS = static_cast<uint8_t>(LEDs::TOTAL);
 
+  // Players served by a single scan chain. Targets are split into equal,
+  // contiguous lanes; See GameSettings::lane_size.
+  constexpr uint8_t MAX_LANES = 4;
+
   // Expression of state for all IO.
   enum class EnaDis: bool {
     Disabled = false,
@@ -82,6 +122,37 @@ namespace types {
     Win = true,
   };
 
+  // Stored game profile. Compact, fixed layout; See Profile.h.
+  struct __attribute__((packed)) GameProfile {
+    uint8_t  version;
+    uint8_t  game_duration;     // in s.
+    uint8_t  win_score;
+    uint8_t  target_value;
+    uint8_t  point_multiplier;
+    uint8_t  bonus_start;       // in s after game start.
+    uint8_t  bonus_end;         // in s after game start.
+    uint8_t  lanes;             // Players; 1 to MAX_LANES.
+    uint16_t hit_cooldown;      // in ms.
+    uint16_t init_wait;         // in ms.
+    uint16_t crc;               // CRC-CCITT of all preceding bytes.
+  };
+  static_assert(sizeof(GameProfile) == 14, "GameProfile layout must not change without a version bump.");
+
+  // Active game settings. Expanded from a GameProfile into the units the
+  // game loop compares against so no conversion happens during play.
+  struct GameSettings {
+    unsigned long hit_cooldown;   // in us.
+    unsigned long game_duration;  // in ms.
+    unsigned long bonus_start;    // in ms after game start.
+    unsigned long bonus_end;      // in ms after game start.
+    uint16_t      init_wait;      // in ms.
+    uint8_t       win_score;
+    uint8_t       target_value;
+    uint8_t       point_multiplier;
+    uint8_t       lanes;
+    uint8_t       lane_size;      // Targets per lane.
+  };
+
 } // namespace types
 
 #endif
\ No newline at end of file
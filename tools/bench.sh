@@ -0,0 +1,71 @@
+#!/usr/bin/env bash
+#
+# Build the firmware in benchmark mode and run it under simavr.
+# Compares cycles per call against tools/bench_baseline.txt and exits
+# non-zero when any benchmark regresses past the allowed tolerance or
+# has no baseline entry.
+#
+# Usage: tools/bench.sh [--update]
+#   --update   Record the current results as the new baseline.
+#
+# Requires: arduino-cli (arduino:avr core, Array and U8g2 libraries), simavr.
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+BUILD="${ROOT}/build/bench"
+BASELINE="${ROOT}/tools/bench_baseline.txt"
+TOLERANCE_PCT="${BENCH_TOLERANCE_PCT:-5}"
+SIM_TIMEOUT="${BENCH_TIMEOUT:-120}"
+
+arduino-cli compile \
+  --fqbn arduino:avr:uno \
+  --build-property "compiler.cpp.extra_flags=-DTARGET_GAME_BENCHMARK" \
+  --output-dir "${BUILD}" \
+  "${ROOT}"
+
+# simavr echoes UART output to the console; strip colour codes and keep results.
+RESULTS="$(timeout "${SIM_TIMEOUT}" simavr -m atmega328p -f 16000000 "${BUILD}/TargetGame.ino.elf" 2>&1 \
+  | sed 's/\x1b\[[0-9;]*m//g' \
+  | grep -o 'BENCH .*' || true)"
+
+if ! grep -q 'BENCH DONE' <<< "${RESULTS}"; then
+  echo "Benchmarks did not complete." >&2
+  exit 1
+fi
+
+RESULTS="$(grep -v 'BENCH DONE' <<< "${RESULTS}" | awk '{print $2, $3}')"
+echo "${RESULTS}"
+
+if [[ "${1:-}" == "--update" ]]; then
+  {
+    echo "# Cycles per call from tools/bench.sh (simavr, atmega328p @ 16 MHz)."
+    echo "# Regenerate with: tools/bench.sh --update"
+    echo "${RESULTS}"
+  } > "${BASELINE}"
+  echo "Baseline recorded: ${BASELINE}"
+  exit 0
+fi
+
+if [[ ! -f "${BASELINE}" ]]; then
+  echo "No baseline at ${BASELINE}; Run with --update to record one." >&2
+  exit 1
+fi
+
+# Fail on any result slower than baseline * (1 + tolerance), or with no
+# baseline entry at all (new or renamed benchmark).
+awk -v tol="${TOLERANCE_PCT}" '
+  NR == FNR { if ($1 !~ /^#/ && NF == 2) base[$1] = $2; next }
+  !($1 in base) {
+    printf "%-16s %10d cycles (baseline %10s) %s\n", $1, $2, "-", "NO BASELINE"
+    failed = 1
+    next
+  }
+  {
+    limit = base[$1] * (100 + tol) / 100
+    status = ($2 > limit) ? "REGRESSION" : "ok"
+    printf "%-16s %10d cycles (baseline %10d) %s\n", $1, $2, base[$1], status
+    if ($2 > limit) failed = 1
+  }
+  END { exit failed }
+' "${BASELINE}" - <<< "${RESULTS}"
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+#
+# Build the firmware and report flash/SRAM usage per module.
+# Lists .text, .data and .bss for each sketch translation unit, the
+# Arduino core and each library, the largest stack frame in each module
+# (from -fstack-usage), then the largest SRAM symbols. Frames are per
+# function; Call depth is not static, so the total stack high-water mark
+# is measured at runtime instead. See MemoryUsage.h.
+#
+# Usage: tools/footprint.sh [extra arduino-cli build flags]
+#
+# Requires: arduino-cli (arduino:avr core, Array and U8g2 libraries).
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+BUILD="${ROOT}/build/footprint"
+SRAM_BYTES=2048
+
+arduino-cli compile \
+  --fqbn arduino:avr:uno \
+  --build-path "${BUILD}" \
+  --build-property "build.extra_flags=-fstack-usage" \
+  "$@" \
+  "${ROOT}"
+
+# Toolchain shipped with the core; fall back to PATH.
+AVR_SIZE="$(command -v avr-size || find ~/.arduino15 -name avr-size -type f | head -n1)"
+AVR_NM="$(command -v avr-nm || find ~/.arduino15 -name avr-nm -type f | head -n1)"
+
+printf "%-28s %8s %8s %8s\n" "module" "text" "data" "bss"
+report() {
+  local name="$1"; shift
+  "${AVR_SIZE}" -t "$@" 2>/dev/null | tail -n1 \
+    | awk -v n="${name}" '{ printf "%-28s %8d %8d %8d\n", n, $1, $2, $3 }'
+}
+
+for obj in "${BUILD}"/sketch/*.o; do
+  report "$(basename "${obj}" .o)" "${obj}"
+done
+report "core" "${BUILD}"/core/*.o
+for lib in "${BUILD}"/libraries/*/; do
+  objs=( $(find "${lib}" -name '*.o') )
+  [[ ${#objs[@]} -gt 0 ]] && report "lib/$(basename "${lib}")" "${objs[@]}"
+done
+
+echo
+printf "%-28s %8s %8s  %s\n" "module" "frame" "dynamic" "largest frame"
+stack_report() {
+  local name="$1"; shift
+  # .su lines: "file:line:col:function<TAB>bytes<TAB>static|dynamic[,bounded]"
+  cat "$@" 2>/dev/null | awk -F'\t' -v n="${name}" '
+    $2 > max { max = $2; fn = $1 }
+    $3 ~ /dynamic/ { dyn++ }
+    END {
+      sub(/^[^:]*:[0-9]+:[0-9]+:/, "", fn)
+      if (NR) printf "%-28s %8d %8d  %s\n", n, max, dyn, fn
+    }'
+}
+
+for su in "${BUILD}"/sketch/*.su; do
+  stack_report "$(basename "${su}" .su)" "${su}"
+done
+stack_report "core" "${BUILD}"/core/*.su
+for lib in "${BUILD}"/libraries/*/; do
+  sus=( $(find "${lib}" -name '*.su') )
+  [[ ${#sus[@]} -gt 0 ]] && stack_report "lib/$(basename "${lib}")" "${sus[@]}"
+done
+
+echo
+"${AVR_SIZE}" -A "${BUILD}/TargetGame.ino.elf" | awk -v sram="${SRAM_BYTES}" '
+  $1 == ".data" { data = $2 }
+  $1 == ".bss"  { bss = $2 }
+  END { printf "static SRAM: %d / %d bytes (%d left for stack)\n", data + bss, sram, sram - data - bss }
+'
+
+echo
+echo "Largest SRAM symbols:"
+"${AVR_NM}" -C --size-sort -r -S "${BUILD}/TargetGame.ino.elf" \
+  | awk '$3 ~ /^[bBdD]$/' | head -n 15
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+Decode the game-event journal into CSV.
+
+Batches come either from a serial capture (lines "JOURNAL <hex>" printed
+at the end of each game) or straight from the board's EEPROM ring. The
+board only services commands while waiting for the start button. Record
+layout and commands are defined in Journal.h.
+
+Usage:
+  journal.py log CAPTURE.txt          > games.csv
+  journal.py dump PORT [--clear]      > games.csv
+
+Dump requires: pyserial.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+TOTAL_TARGETS = 11      # types::TOTAL_TARGETS
+DEFAULT_SLOT = 4        # profile::PROFILE_SLOTS; Built-in profile.
+
+GAME_START, HIT, REJECT, GAME_END = 1, 2, 3, 4
+EVENT_NAMES = {GAME_START: "game_start", HIT: "hit", REJECT: "reject", GAME_END: "game_end"}
+
+COLUMNS = ("game", "time_ms", "event", "target", "lane", "points", "lane_score",
+           "lanes", "profile", "wait_s", "dropped")
+
+
+def varint(data, pos):
+    """Decode unsigned LEB128 starting at pos. Returns (value, next pos)."""
+    value, shift = 0, 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def decode_batch(game, data):
+    """Yield one CSV row per record of a single game batch."""
+    pos, time_ms, lanes, scores = 0, 0, 1, {}
+    while pos < len(data):
+        header = data[pos]
+        event, arg = header >> 4, header & 0x0F
+        delta, pos = varint(data, pos + 1)
+        time_ms += delta
+        row = dict.fromkeys(COLUMNS, "")
+        row.update(game=game, time_ms=time_ms, event=EVENT_NAMES.get(event, f"unknown_{event}"))
+
+        if event == GAME_START:
+            lanes = max(arg, 1)
+            slot, pos = data[pos], pos + 1
+            wait_s, pos = varint(data, pos)
+            row.update(lanes=lanes, profile="default" if slot == DEFAULT_SLOT else slot, wait_s=wait_s)
+        elif event in (HIT, REJECT):
+            lane = arg // (TOTAL_TARGETS // lanes)
+            row.update(target=arg, lane=lane)
+            if event == HIT:
+                points, pos = data[pos], pos + 1
+                scores[lane] = scores.get(lane, 0) + points
+                row.update(points=points, lane_score=scores[lane])
+        elif event == GAME_END:
+            row.update(dropped=data[pos])
+            pos += 1
+        else:
+            raise ValueError(f"game {game}: unknown event {event} at byte {pos}")
+        yield row
+
+
+def batches_from_log(path):
+    with open(path, errors="replace") as capture:
+        for line in capture:
+            _, marker, payload = line.partition("JOURNAL ")
+            if marker:
+                yield bytes.fromhex(payload.strip())
+
+
+def batches_from_ring(ring):
+    pos = 0
+    while pos < len(ring):
+        length = ring[pos]
+        yield ring[pos + 1:pos + 1 + length]
+        pos += 1 + length
+
+
+def dump(port_name, clear):
+    import serial
+
+    # Hold DTR low on open so the Uno is not reset mid-session.
+    port = serial.Serial(baudrate=9600, timeout=5)
+    port.port = port_name
+    port.dtr = False
+    with port:
+        port.reset_input_buffer()
+        port.write(b"J")
+        if port.read(1) != b"K":
+            sys.exit("No reply from board.")
+        (size,) = struct.unpack("<H", port.read(2))
+        ring = port.read(size)
+        if len(ring) != size:
+            sys.exit("Journal dump truncated.")
+        if clear:
+            port.write(b"C")
+            if port.read(1) != b"K":
+                sys.exit("Board did not clear journal.")
+    return list(batches_from_ring(ring))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="source", required=True)
+    log = sub.add_parser("log", help="Decode JOURNAL lines from a serial capture.")
+    log.add_argument("capture")
+    pull = sub.add_parser("dump", help="Download the EEPROM journal from the board.")
+    pull.add_argument("port")
+    pull.add_argument("--clear", action="store_true", help="Erase the journal after download.")
+    args = parser.parse_args()
+
+    batches = batches_from_log(args.capture) if args.source == "log" else dump(args.port, args.clear)
+
+    writer = csv.DictWriter(sys.stdout, fieldnames=COLUMNS)
+    writer.writeheader()
+    for game, batch in enumerate(batches, start=1):
+        writer.writerows(decode_batch(game, batch))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Encode, store and select game profiles over serial without reflashing.
+
+The board services commands only while waiting for the start button.
+Profile layout and commands are defined in Types.h (GameProfile) and
+Profile.h.
+
+Usage:
+  profile.py PORT write SLOT [--duration S] [--win-score N] [--target-value N]
+                             [--multiplier N] [--bonus-start S] [--bonus-end S]
+                             [--lanes N] [--cooldown MS] [--init-wait MS]
+  profile.py PORT select SLOT
+  profile.py PORT read SLOT
+
+Requires: pyserial.
+"""
+
+import argparse
+import struct
+import sys
+
+import serial
+
+PROFILE_VERSION = 2
+PROFILE_SLOTS = 4
+
+# version, duration, win, value, multiplier, bonus start, bonus end, lanes,
+# cooldown, init wait, crc. Little endian, no padding (14 bytes).
+PROFILE_FORMAT = "<8B3H"
+PROFILE_BODY_FORMAT = "<8B2H"   # Everything covered by the crc.
+PROFILE_FIELDS = ("version", "duration", "win_score", "target_value", "multiplier",
+                  "bonus_start", "bonus_end", "lanes", "cooldown", "init_wait", "crc")
+
+ACK = b"K"
+NACK = b"E"
+
+
+def crc_ccitt_update(crc, data):
+    """Mirror of avr-libc _crc_ccitt_update()."""
+    data ^= crc & 0xFF
+    data = (data ^ (data << 4)) & 0xFF
+    return (((data << 8) | (crc >> 8)) ^ (data >> 4) ^ (data << 3)) & 0xFFFF
+
+
+def check(args):
+    """Mirror of ProfileInterface::valid(); Reject what the board would."""
+    errors = []
+    if not 0 < args.duration < 100:
+        errors.append("duration must be 1-99 s")
+    if not args.bonus_start <= args.bonus_end <= args.duration:
+        errors.append("bonus window must satisfy start <= end <= duration")
+    if args.win_score <= 0:
+        errors.append("win score must be > 0")
+    if args.cooldown <= 0:
+        errors.append("cooldown must be > 0")
+    if args.target_value * args.multiplier > 0xFF:
+        errors.append("target value * multiplier must be <= 255")
+    if errors:
+        sys.exit("Invalid profile: " + "; ".join(errors) + ".")
+
+
+def encode(args):
+    body = struct.pack(PROFILE_BODY_FORMAT, PROFILE_VERSION, args.duration, args.win_score,
+                       args.target_value, args.multiplier, args.bonus_start, args.bonus_end,
+                       args.lanes, args.cooldown, args.init_wait)
+    crc = 0xFFFF
+    for byte in body:
+        crc = crc_ccitt_update(crc, byte)
+    return body + struct.pack("<H", crc)
+
+
+def command(port, cmd, slot, payload=b"", reply=0):
+    port.reset_input_buffer()
+    port.write(cmd + bytes([slot]) + payload)
+    status = port.read(1)
+    if status != ACK:
+        sys.exit("Board rejected command." if status == NACK else "No reply from board.")
+    return port.read(reply)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port")
+    parser.add_argument("action", choices=("write", "select", "read"))
+    parser.add_argument("slot", type=int, choices=range(PROFILE_SLOTS))
+    parser.add_argument("--duration", type=int, default=60, help="Game duration (s, < 100).")
+    parser.add_argument("--win-score", type=int, default=25)
+    parser.add_argument("--target-value", type=int, default=5)
+    parser.add_argument("--multiplier", type=int, default=2)
+    parser.add_argument("--bonus-start", type=int, default=40, help="Seconds after game start.")
+    parser.add_argument("--bonus-end", type=int, default=50, help="Seconds after game start.")
+    parser.add_argument("--lanes", type=int, default=1, choices=range(1, 5),
+                        help="Players sharing the booth; Targets are split evenly.")
+    parser.add_argument("--cooldown", type=int, default=3000, help="Per-target hit cooldown (ms).")
+    parser.add_argument("--init-wait", type=int, default=500, help="Self-test step delay (ms).")
+    args = parser.parse_args()
+    if args.action == "write":
+        check(args)
+
+    # Hold DTR low on open so the Uno is not reset mid-session.
+    port = serial.Serial(baudrate=9600, timeout=2)
+    port.port = args.port
+    port.dtr = False
+    with port:
+        if args.action == "write":
+            command(port, b"W", args.slot, encode(args))
+        elif args.action == "select":
+            command(port, b"S", args.slot)
+        else:
+            raw = command(port, b"R", args.slot, reply=struct.calcsize(PROFILE_FORMAT))
+            for name, value in zip(PROFILE_FIELDS, struct.unpack(PROFILE_FORMAT, raw)):
+                print(f"{name}: {value}")
+    print("OK")
+
+
+if __name__ == "__main__":
+    main()